@@ -0,0 +1,163 @@
+/*!
+	@file     main.cpp
+	@author   Gavin Lyons
+	@brief Example cpp file for ST7789_TFT_PICO library.
+			Offscreen canvas tests.
+	@note  See USER OPTIONS 0-2 in SETUP function
+
+	@test
+		-# Test1200 Gauge widget composed in a canvas, pushed as one window per update
+		-# Test1201 One canvas pushed to several places on the screen
+*/
+
+// Section ::  libraries
+#include "pico/time.h"
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "st7789/ST7789_TFT.hpp"
+#include "st7789/ST7789_TFT_canvas16.hpp"
+
+// Section :: Defines
+//  Test timing related defines
+#define TEST_DELAY1 1000 // mS
+#define TEST_DELAY2 2000 // mS
+#define TEST_DELAY5 5000 // mS
+
+#define CANVAS_WIDTH 120  // Gauge canvas width in pixels
+#define CANVAS_HEIGHT 80  // Gauge canvas height in pixels
+
+// Section :: Globals
+ST7789_TFT myTFT;
+ST7789_TFT_canvas16 myCanvas;
+uint16_t canvasBuffer[CANVAS_WIDTH * CANVAS_HEIGHT]; // 19200 bytes
+
+//  Section ::  Function Headers
+
+void Setup(void); // setup + user options
+void Test1200(void);
+void Test1201(void);
+void drawGauge(uint8_t percent);
+void EndTests(void);
+
+//  Section ::  MAIN loop
+
+int main(void)
+{
+	Setup();
+	Test1200();
+	Test1201();
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+//  Section ::  Function Space
+
+/*!
+	@brief setup the TFT :: user options 0-2
+*/
+void Setup(void)
+{
+	stdio_init_all(); // optional for error messages , Initialize chosen serial port, default 38400 baud
+	TFT_MILLISEC_DELAY(TEST_DELAY1);
+	printf("TFT :: Start\r\n");
+
+//*************** USER OPTION 0 SPI_SPEED + TYPE ***********
+	bool bhardwareSPI = true; // true for hardware spi, false for software
+
+	if (bhardwareSPI == true) { // hw spi
+		uint32_t TFT_SCLK_FREQ =  8000 ; // Spi freq in KiloHertz , 1000 = 1Mhz
+		myTFT.TFTInitSPIType(TFT_SCLK_FREQ, spi0, true); // DMA on, a push is one burst
+	} else { // sw spi
+		uint16_t SWSPICommDelay = 0; // optional SW SPI GPIO delay in uS
+		myTFT.TFTInitSPIType(SWSPICommDelay);
+	}
+//*********************************************************
+// ******** USER OPTION 1 GPIO *********
+// NOTE if using Hardware SPI clock and data pins will be tied to
+// the chosen interface eg Spi0 CLK=18 DIN=19)
+	int8_t SDIN_TFT = 19;
+	int8_t SCLK_TFT = 18;
+	int8_t DC_TFT = 3;
+	int8_t CS_TFT = 2 ;
+	int8_t RST_TFT = 17;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT, CS_TFT, SCLK_TFT, SDIN_TFT);
+//**********************************************************
+
+// ****** USER OPTION 2 Screen Setup ******
+	uint16_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint16_t OFFSET_ROW = 0; // 3, with screen manufacture tolerance/defects
+	uint16_t TFT_WIDTH = 240;// Screen width in pixels
+	uint16_t TFT_HEIGHT = 280; // Screen height in pixels
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW , TFT_WIDTH , TFT_HEIGHT);
+// ******************************************
+
+	myTFT.TFTST7789Initialize();
+	myCanvas.TFTcanvasBegin(canvasBuffer, CANVAS_WIDTH, CANVAS_HEIGHT);
+}
+
+/*!
+	@brief Draw a bar gauge widget into the canvas
+	@param percent bar fill 0-100
+	@note The whole widget is redrawn each time, overdraw costs no bus traffic.
+*/
+void drawGauge(uint8_t percent)
+{
+	char label[8];
+	uint16_t barWidth = ((CANVAS_WIDTH - 20) * percent) / 100;
+	myTFT.TFTDMAWait(); // the last push may still be reading the canvas
+	myCanvas.TFTfillScreen(ST7789_NAVY);
+	myCanvas.TFTdrawRoundRect(0, 0, CANVAS_WIDTH, CANVAS_HEIGHT, 8, ST7789_WHITE);
+	myCanvas.TFTfillRect(10, 45, barWidth, 20, (percent > 80) ? ST7789_RED : ST7789_GREEN);
+	myCanvas.TFTdrawRectWH(10, 45, CANVAS_WIDTH - 20, 20, ST7789_WHITE);
+	snprintf(label, sizeof(label), "%3u%%", percent);
+	myCanvas.TFTFontNum(myCanvas.TFTFont_Default);
+	myCanvas.TFTdrawText(30, 12, label, ST7789_WHITE, ST7789_NAVY, 3);
+}
+
+/*!
+	@brief Gauge updates, each one composed offscreen and sent with one address window
+*/
+void Test1200(void)
+{
+	printf("Test 1200: Canvas gauge\r\n");
+	myTFT.TFTfillScreen(ST7789_BLACK);
+	uint32_t start = to_ms_since_boot(get_absolute_time());
+	for (uint8_t percent = 0; percent <= 100; percent++)
+	{
+		drawGauge(percent);
+		myCanvas.TFTcanvasPush(myTFT, 60, 100);
+	}
+	myTFT.TFTDMAWait();
+	uint32_t elapsed = to_ms_since_boot(get_absolute_time()) - start;
+	printf("101 updates in %lu mS\r\n", (unsigned long)elapsed);
+	TFT_MILLISEC_DELAY(TEST_DELAY2);
+}
+
+/*!
+	@brief The same canvas pushed to several places, drawn once
+*/
+void Test1201(void)
+{
+	printf("Test 1201: Canvas pushed to several places\r\n");
+	myTFT.TFTfillScreen(ST7789_BLACK);
+	drawGauge(42);
+	myCanvas.TFTcanvasPush(myTFT, 0, 0);
+	myCanvas.TFTcanvasPush(myTFT, 120, 0);
+	myCanvas.TFTcanvasPush(myTFT, 0, 100);
+	myCanvas.TFTcanvasPush(myTFT, 120, 100);
+	myCanvas.TFTcanvasPush(myTFT, 180, 200); // clipped at the right edge
+	myTFT.TFTDMAWait();
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+}
+
+/*!
+	@brief  Stop testing and shutdown the TFT
+*/
+void EndTests(void)
+{
+	myTFT.TFTPowerDown();
+	printf("TFT :: Tests Over \n");
+}
+
+// *************** EOF ****************
@@ -0,0 +1,166 @@
+/*!
+	@file     main.cpp
+	@author   Gavin Lyons
+	@brief Example cpp file for ST7789_TFT_PICO library.
+			Frame buffer mode and band mode tests.
+	@note  See USER OPTIONS 0-2 in SETUP function
+
+	@test
+		-# Test1100 Frame buffer, moving ball, only the changed tiles are flushed, FPS
+		-# Test1101 Band mode, a frame drawn through a small strip buffer
+*/
+
+// Section ::  libraries
+#include "pico/time.h"
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "st7789/ST7789_TFT.hpp"
+
+// Section :: Defines
+//  Test timing related defines
+#define TEST_DELAY1 1000 // mS
+#define TEST_DELAY2 2000 // mS
+#define TEST_DELAY5 5000 // mS
+
+#define MY_WIDTH 240  // Screen width in pixels, see USER OPTION 2
+#define MY_HEIGHT 280 // Screen height in pixels
+#define STRIP_ROWS 16 // Rows in the band mode strip buffer
+
+// Section :: Globals
+ST7789_TFT myTFT;
+uint16_t frameBuffer[MY_WIDTH * MY_HEIGHT]; // 134400 bytes
+uint16_t strip[MY_WIDTH * STRIP_ROWS];      // 7680 bytes
+
+//  Section ::  Function Headers
+
+void Setup(void); // setup + user options
+void Test1100(void);
+void Test1101(void);
+void EndTests(void);
+
+//  Section ::  MAIN loop
+
+int main(void)
+{
+	Setup();
+	Test1100();
+	Test1101();
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+//  Section ::  Function Space
+
+/*!
+	@brief setup the TFT :: user options 0-2
+*/
+void Setup(void)
+{
+	stdio_init_all(); // optional for error messages , Initialize chosen serial port, default 38400 baud
+	TFT_MILLISEC_DELAY(TEST_DELAY1);
+	printf("TFT :: Start\r\n");
+
+//*************** USER OPTION 0 SPI_SPEED + TYPE ***********
+	bool bhardwareSPI = true; // true for hardware spi, false for software
+
+	if (bhardwareSPI == true) { // hw spi
+		uint32_t TFT_SCLK_FREQ =  8000 ; // Spi freq in KiloHertz , 1000 = 1Mhz
+		myTFT.TFTInitSPIType(TFT_SCLK_FREQ, spi0, true); // DMA on, flushes are sent in the background
+	} else { // sw spi
+		uint16_t SWSPICommDelay = 0; // optional SW SPI GPIO delay in uS
+		myTFT.TFTInitSPIType(SWSPICommDelay);
+	}
+//*********************************************************
+// ******** USER OPTION 1 GPIO *********
+// NOTE if using Hardware SPI clock and data pins will be tied to
+// the chosen interface eg Spi0 CLK=18 DIN=19)
+	int8_t SDIN_TFT = 19;
+	int8_t SCLK_TFT = 18;
+	int8_t DC_TFT = 3;
+	int8_t CS_TFT = 2 ;
+	int8_t RST_TFT = 17;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT, CS_TFT, SCLK_TFT, SDIN_TFT);
+//**********************************************************
+
+// ****** USER OPTION 2 Screen Setup ******
+	uint16_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint16_t OFFSET_ROW = 0; // 3, with screen manufacture tolerance/defects
+	uint16_t TFT_WIDTH = MY_WIDTH;// Screen width in pixels
+	uint16_t TFT_HEIGHT = MY_HEIGHT; // Screen height in pixels
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW , TFT_WIDTH , TFT_HEIGHT);
+// ******************************************
+
+	myTFT.TFTST7789Initialize();
+}
+
+/*!
+	@brief Frame buffer mode. Drawing goes to RAM, TFTflush sends only the
+		16x16 tiles touched since the last flush, here the ball and the counter.
+*/
+void Test1100(void)
+{
+	printf("Test 1100: Frame buffer, moving ball\r\n");
+	if (myTFT.TFTsetFrameBuffer(frameBuffer, MY_WIDTH * MY_HEIGHT) != Display_Success)
+		return;
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+	myTFT.TFTfillScreen(ST7789_NAVY);
+	myTFT.TFTdrawRectWH(0, 0, MY_WIDTH, MY_HEIGHT, ST7789_WHITE);
+	myTFT.TFTflush(); // whole screen is dirty once
+
+	const uint8_t radius = 12;
+	int16_t x = 40, y = 60, dx = 3, dy = 2;
+	char counter[12];
+	uint16_t frames = 300;
+	uint32_t start = to_ms_since_boot(get_absolute_time());
+	for (uint16_t frame = 0; frame < frames; frame++)
+	{
+		myTFT.TFTfillCircle(x, y, radius, ST7789_NAVY); // erase
+		x += dx;
+		y += dy;
+		if (x - radius <= 2 || x + radius >= MY_WIDTH - 3) dx = -dx;
+		if (y - radius <= 30 || y + radius >= MY_HEIGHT - 3) dy = -dy;
+		myTFT.TFTfillCircle(x, y, radius, ST7789_YELLOW);
+		snprintf(counter, sizeof(counter), "%05u", frame);
+		myTFT.TFTdrawText(10, 10, counter, ST7789_WHITE, ST7789_NAVY, 2);
+		myTFT.TFTflush();
+	}
+	uint32_t elapsed = to_ms_since_boot(get_absolute_time()) - start;
+	printf("%u frames in %lu mS\r\n", frames, (unsigned long)elapsed);
+	myTFT.TFTsetFrameBuffer(nullptr, 0); // back to drawing straight to the display
+	TFT_MILLISEC_DELAY(TEST_DELAY2);
+}
+
+/*!
+	@brief Band mode. The frame is drawn once per band of STRIP_ROWS rows,
+		for builds without RAM for a full frame buffer.
+*/
+void Test1101(void)
+{
+	printf("Test 1101: Band mode\r\n");
+	char teststr1[] = "Band mode";
+	uint32_t start = to_ms_since_boot(get_absolute_time());
+	if (myTFT.TFTbandBegin(strip, MY_WIDTH * STRIP_ROWS, ST7789_BLACK) != Display_Success)
+		return;
+	do {
+		for (uint16_t i = 0; i < 8; i++)
+			myTFT.TFTfillRect(0, i * 35, MY_WIDTH, 20, (i & 1) ? ST7789_DGREEN : ST7789_BLUE);
+		myTFT.TFTfillCircle(120, 140, 60, ST7789_RED);
+		myTFT.TFTdrawCircle(120, 140, 80, ST7789_WHITE);
+		myTFT.TFTdrawText(40, 130, teststr1, ST7789_WHITE, ST7789_RED, 2);
+	} while (myTFT.TFTbandNext());
+	uint32_t elapsed = to_ms_since_boot(get_absolute_time()) - start;
+	printf("Frame in %lu mS\r\n", (unsigned long)elapsed);
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+}
+
+/*!
+	@brief  Stop testing and shutdown the TFT
+*/
+void EndTests(void)
+{
+	myTFT.TFTPowerDown();
+	printf("TFT :: Tests Over \n");
+}
+
+// *************** EOF ****************
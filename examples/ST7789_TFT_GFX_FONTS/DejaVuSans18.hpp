@@ -0,0 +1,584 @@
+/*!
+	@file     DejaVuSans18.hpp
+	@brief    DejaVuSans18 proportional font for the ST7789_TFT_PICO library,
+			  from DejaVuSans.ttf, 95 glyphs, 4 bpp.
+	@note     Generated by extra/tools/font_compiler.py, do not edit.
+*/
+
+#pragma once
+
+#include "st7789/ST7789_TFT_Font.hpp"
+
+static const uint8_t DejaVuSans18Bitmaps[] = {
+	// '!'
+	0x4F, 0x84, 0xF8, 0x4F, 0x84, 0xF8, 0x4F, 0x84, 0xF7, 0x4F, 0x73, 0xF6, 0x2F, 0x50, 0x00, 0x00,
+	0x04, 0xF8, 0x4F, 0x80,
+	// '"'
+	0x4F, 0x30, 0xE8, 0x4F, 0x30, 0xE8, 0x4F, 0x30, 0xE8, 0x4F, 0x30, 0xE8, 0x4F, 0x30, 0xE8,
+	// '#'
+	0x00, 0x00, 0x0A, 0xC0, 0x0A, 0xB0, 0x00, 0x00, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x2F,
+	0x50, 0x2F, 0x40, 0x00, 0x00, 0x05, 0xF1, 0x05, 0xF1, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xB0, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0xE7, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x5F,
+	0x10, 0x5F, 0x10, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xA0, 0x00, 0x0E, 0x70, 0x0E, 0x60, 0x00, 0x00, 0x03, 0xF3, 0x03, 0xF3, 0x00, 0x00, 0x00, 0x6F,
+	0x00, 0x6E, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x0A, 0xB0, 0x00, 0x00,
+	// '$'
+	0x00, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x01, 0x9D, 0xFE, 0xB5, 0x01, 0xDF, 0xFF,
+	0xFF, 0xF2, 0x5F, 0xB2, 0xC2, 0x4A, 0x27, 0xF2, 0x0C, 0x10, 0x00, 0x4F, 0x70, 0xC1, 0x00, 0x00,
+	0x8F, 0xDE, 0x73, 0x00, 0x00, 0x27, 0xED, 0xFB, 0x10, 0x00, 0x0C, 0x13, 0xEA, 0x00, 0x00, 0xC1,
+	0x0B, 0xD7, 0x83, 0x0C, 0x26, 0xFC, 0x8F, 0xFF, 0xFF, 0xFF, 0x51, 0x6B, 0xEF, 0xEB, 0x40, 0x00,
+	0x00, 0xC1, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00,
+	// '%'
+	0x08, 0xEE, 0x90, 0x00, 0x00, 0x5E, 0x10, 0x00, 0x7E, 0x32, 0xD8, 0x00, 0x01, 0xE6, 0x00, 0x00,
+	0xD8, 0x00, 0x7E, 0x00, 0x09, 0xC0, 0x00, 0x00, 0xF6, 0x00, 0x6F, 0x00, 0x4F, 0x30, 0x00, 0x00,
+	0xD8, 0x00, 0x7E, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x7D, 0x22, 0xD8, 0x08, 0xD0, 0x00, 0x00, 0x00,
+	0x08, 0xEE, 0x91, 0x3F, 0x40, 0x8D, 0xE9, 0x10, 0x00, 0x00, 0x00, 0xC9, 0x07, 0xE3, 0x2D, 0x90,
+	0x00, 0x00, 0x06, 0xE1, 0x0C, 0x90, 0x07, 0xE0, 0x00, 0x00, 0x1E, 0x50, 0x0E, 0x70, 0x05, 0xF1,
+	0x00, 0x00, 0xAB, 0x00, 0x0C, 0x90, 0x07, 0xE0, 0x00, 0x05, 0xE2, 0x00, 0x07, 0xE3, 0x2D, 0x90,
+	0x00, 0x1D, 0x70, 0x00, 0x00, 0x8D, 0xE9, 0x10,
+	// '&'
+	0x00, 0x2A, 0xDE, 0xB5, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x04, 0xFB, 0x20,
+	0x3A, 0x20, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEC, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x1C, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x1C, 0xB3, 0xDD, 0x30, 0x00, 0xDC, 0x08, 0xF2, 0x01,
+	0xCE, 0x50, 0x2F, 0x70, 0xCD, 0x00, 0x01, 0xBF, 0x79, 0xE1, 0x0C, 0xF2, 0x00, 0x00, 0x9F, 0xF5,
+	0x00, 0x8F, 0xD5, 0x11, 0x3A, 0xFF, 0x80, 0x01, 0xCF, 0xFF, 0xFF, 0xF6, 0x9F, 0x50, 0x01, 0x7C,
+	0xFE, 0xB3, 0x01, 0xEE, 0x20,
+	// 0x27
+	0x4F, 0x34, 0xF3, 0x4F, 0x34, 0xF3, 0x4F, 0x30,
+	// '('
+	0x00, 0x2F, 0x50, 0x0A, 0xC0, 0x03, 0xF6, 0x00, 0x9E, 0x10, 0x0E, 0xB0, 0x03, 0xF8, 0x00, 0x5F,
+	0x60, 0x06, 0xF4, 0x00, 0x6F, 0x50, 0x05, 0xF6, 0x00, 0x2F, 0x80, 0x00, 0xEB, 0x00, 0x09, 0xE1,
+	0x00, 0x2F, 0x60, 0x00, 0xAC, 0x00, 0x02, 0xF5,
+	// ')'
+	0x5F, 0x20, 0x00, 0xCA, 0x00, 0x05, 0xF3, 0x00, 0x1E, 0x90, 0x00, 0xBE, 0x00, 0x07, 0xF3, 0x00,
+	0x5F, 0x50, 0x04, 0xF6, 0x00, 0x4F, 0x60, 0x05, 0xF5, 0x00, 0x7F, 0x30, 0x0B, 0xE0, 0x01, 0xE9,
+	0x00, 0x5F, 0x30, 0x0C, 0xA0, 0x05, 0xF2, 0x00,
+	// '*'
+	0x00, 0x00, 0xF0, 0x00, 0x03, 0xA1, 0x0F, 0x01, 0xA3, 0x19, 0xD4, 0xF4, 0xD9, 0x10, 0x04, 0xDF,
+	0xD4, 0x00, 0x00, 0x4D, 0xFD, 0x40, 0x01, 0x9D, 0x4F, 0x4D, 0x91, 0x3A, 0x10, 0xF0, 0x1A, 0x30,
+	0x00, 0x0F, 0x00, 0x00,
+	// '+'
+	0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00,
+	0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+	0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x00,
+	// ','
+	0x0D, 0xF0, 0xED, 0x3F, 0x57, 0xC0,
+	// '-'
+	0x2F, 0xFF, 0xF9, 0x2F, 0xFF, 0xF9,
+	// '.'
+	0x1F, 0xC1, 0xFC,
+	// '/'
+	0x00, 0x00, 0x9E, 0x00, 0x00, 0xD9, 0x00, 0x03, 0xF5, 0x00, 0x07, 0xE1, 0x00, 0x0C, 0xA0, 0x00,
+	0x2F, 0x60, 0x00, 0x6F, 0x10, 0x00, 0xBC, 0x00, 0x01, 0xF7, 0x00, 0x05, 0xF3, 0x00, 0x09, 0xD0,
+	0x00, 0x0E, 0x80, 0x00, 0x4F, 0x40, 0x00, 0x8E, 0x00, 0x00, 0xDA, 0x00, 0x00,
+	// '0'
+	0x00, 0x6C, 0xFE, 0x91, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x10, 0x2F, 0xE5, 0x02, 0xBF, 0x80, 0x7F,
+	0x70, 0x00, 0x1E, 0xD0, 0xAF, 0x20, 0x00, 0x0B, 0xF1, 0xBF, 0x00, 0x00, 0x09, 0xF3, 0xCF, 0x00,
+	0x00, 0x08, 0xF4, 0xBF, 0x00, 0x00, 0x09, 0xF3, 0xAF, 0x20, 0x00, 0x0B, 0xF1, 0x7F, 0x70, 0x00,
+	0x1E, 0xD0, 0x2F, 0xE5, 0x02, 0xBF, 0x80, 0x07, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x6C, 0xFE, 0x91,
+	0x00,
+	// '1'
+	0x27, 0xCF, 0xD0, 0x00, 0xFF, 0xFF, 0xD0, 0x00, 0xD8, 0x3D, 0xD0, 0x00, 0x00, 0x0D, 0xD0, 0x00,
+	0x00, 0x0D, 0xD0, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x0D, 0xD0, 0x00,
+	0x00, 0x0D, 0xD0, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0xCF, 0xFF, 0xFF, 0xFC,
+	0xCF, 0xFF, 0xFF, 0xFC,
+	// '2'
+	0x16, 0xBE, 0xEC, 0x71, 0x09, 0xFF, 0xFF, 0xFF, 0xC1, 0x89, 0x41, 0x14, 0xDF, 0x60, 0x00, 0x00,
+	0x05, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x0B, 0xD1, 0x00, 0x00, 0x0A, 0xE3, 0x00,
+	0x00, 0x1A, 0xE3, 0x00, 0x00, 0x1C, 0xE3, 0x00, 0x00, 0x2D, 0xD2, 0x00, 0x00, 0x3E, 0xD2, 0x00,
+	0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFA, 0xAF, 0xFF, 0xFF, 0xFF, 0xA0,
+	// '3'
+	0x04, 0xAD, 0xED, 0x92, 0x04, 0xFF, 0xFF, 0xFF, 0xE3, 0x3A, 0x42, 0x02, 0xAF, 0x90, 0x00, 0x00,
+	0x02, 0xFA, 0x00, 0x00, 0x02, 0xAF, 0x50, 0x05, 0xFF, 0xFD, 0x60, 0x00, 0x5F, 0xFF, 0xE9, 0x00,
+	0x00, 0x01, 0x3A, 0xF9, 0x00, 0x00, 0x00, 0x0D, 0xE0, 0x00, 0x00, 0x00, 0xDF, 0x87, 0x31, 0x13,
+	0xAF, 0xB9, 0xFF, 0xFF, 0xFF, 0xE3, 0x17, 0xCE, 0xFD, 0x92, 0x00,
+	// '4'
+	0x00, 0x00, 0x01, 0xEF, 0x80, 0x00, 0x00, 0x00, 0xAD, 0xF8, 0x00, 0x00, 0x00, 0x5E, 0x5F, 0x80,
+	0x00, 0x00, 0x1E, 0x63, 0xF8, 0x00, 0x00, 0x0A, 0xB0, 0x3F, 0x80, 0x00, 0x04, 0xE2, 0x03, 0xF8,
+	0x00, 0x01, 0xD5, 0x00, 0x3F, 0x80, 0x00, 0x9A, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x03,
+	0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00,
+	// '5'
+	0x1F, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0x80, 0x00, 0x00, 0x01, 0xF8, 0x00,
+	0x00, 0x00, 0x1F, 0xDE, 0xFD, 0x70, 0x01, 0xFF, 0xFF, 0xFF, 0xC1, 0x1A, 0x41, 0x15, 0xDF, 0x70,
+	0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x03, 0xFC, 0x87, 0x31, 0x15,
+	0xDF, 0x79, 0xFF, 0xFF, 0xFF, 0xC1, 0x17, 0xCE, 0xEC, 0x70, 0x00,
+	// '6'
+	0x00, 0x18, 0xDF, 0xD8, 0x10, 0x02, 0xDF, 0xFF, 0xFF, 0x70, 0x0B, 0xFC, 0x40, 0x27, 0x60, 0x4F,
+	0xE1, 0x00, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0xAF, 0x48, 0xEF, 0xC6, 0x00, 0xBF, 0xAF,
+	0xFF, 0xFF, 0x70, 0xBF, 0xE5, 0x11, 0x6F, 0xF1, 0x9F, 0x70, 0x00, 0x09, 0xF4, 0x6F, 0x70, 0x00,
+	0x09, 0xF4, 0x1E, 0xE5, 0x11, 0x6F, 0xF1, 0x06, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x5C, 0xEE, 0xC5,
+	0x00,
+	// '7'
+	0x8F, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x00,
+	0x0C, 0xD0, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x00, 0xAF, 0x10, 0x00, 0x00, 0x1F, 0xA0, 0x00,
+	0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x0A, 0xF2,
+	0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00,
+	// '8'
+	0x01, 0x8D, 0xEE, 0xB4, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0x60, 0x6F, 0xC3, 0x01, 0x7F, 0xC0, 0x6F,
+	0x50, 0x00, 0x0E, 0xD0, 0x2E, 0xC3, 0x01, 0x7F, 0x80, 0x03, 0xBF, 0xFF, 0xE8, 0x00, 0x06, 0xDF,
+	0xFF, 0xFA, 0x10, 0x5F, 0xB3, 0x11, 0x7F, 0xB0, 0xAF, 0x20, 0x00, 0x0A, 0xF2, 0xBF, 0x20, 0x00,
+	0x0A, 0xF3, 0x9F, 0xB3, 0x01, 0x7F, 0xE1, 0x2E, 0xFF, 0xFF, 0xFF, 0x70, 0x02, 0x9D, 0xFE, 0xC5,
+	0x00,
+	// '9'
+	0x02, 0x9D, 0xFD, 0x81, 0x00, 0x2E, 0xFF, 0xFF, 0xFC, 0x00, 0x9F, 0xB2, 0x02, 0xAF, 0x70, 0xCF,
+	0x10, 0x00, 0x0F, 0xC0, 0xCF, 0x10, 0x00, 0x0F, 0xF0, 0x9F, 0xA2, 0x02, 0xAF, 0xF2, 0x2E, 0xFF,
+	0xFF, 0xEB, 0xF3, 0x02, 0xAE, 0xFB, 0x3C, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+	0x8F, 0xA0, 0x0B, 0x41, 0x28, 0xFF, 0x30, 0x0F, 0xFF, 0xFF, 0xF7, 0x00, 0x04, 0xBE, 0xEB, 0x40,
+	0x00,
+	// ':'
+	0xDF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xDF,
+	// ';'
+	0x0D, 0xF0, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x0E, 0xD3, 0xF5, 0x7C,
+	0x00,
+	// '<'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0x20, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xD2, 0x00, 0x00, 0x27,
+	0xDF, 0xEA, 0x40, 0x00, 0x05, 0xBF, 0xFB, 0x61, 0x00, 0x00, 0x1E, 0xFD, 0x82, 0x00, 0x00, 0x00,
+	0x01, 0xEF, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x02,
+	0x7D, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x16,
+	0xB2,
+	// '='
+	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+	// '>'
+	0x1C, 0x61, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xEA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x49, 0xEF,
+	0xD8, 0x20, 0x00, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x02, 0x7D, 0xFE,
+	0x20, 0x00, 0x00, 0x00, 0x17, 0xCF, 0xE2, 0x00, 0x00, 0x15, 0xBF, 0xFB, 0x61, 0x00, 0x04, 0x9E,
+	0xFD, 0x82, 0x00, 0x00, 0x1D, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x01, 0xC6, 0x10, 0x00, 0x00, 0x00,
+	0x00,
+	// '?'
+	0x28, 0xCE, 0xD9, 0x10, 0xBF, 0xFF, 0xFF, 0xB0, 0x97, 0x20, 0x4E, 0xF2, 0x00, 0x00, 0x08, 0xF4,
+	0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x5F, 0x70, 0x00,
+	0x00, 0x7F, 0x30, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00,
+	0x00, 0x8F, 0x30, 0x00,
+	// '@'
+	0x00, 0x00, 0x28, 0xCE, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00,
+	0x00, 0x9F, 0xE8, 0x31, 0x01, 0x49, 0xFE, 0x30, 0x07, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x2D, 0xD1,
+	0x1E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xE6, 0x6F, 0x10, 0x04, 0xCE, 0xD4, 0x8B, 0x00, 0x9A,
+	0xAA, 0x00, 0x4F, 0xFF, 0xFF, 0xAB, 0x00, 0x9B, 0xC7, 0x00, 0x9E, 0x41, 0x13, 0xDB, 0x00, 0xD9,
+	0xC7, 0x00, 0x9E, 0x41, 0x03, 0xDB, 0x3B, 0xF4, 0xAA, 0x00, 0x4F, 0xFF, 0xFF, 0xAF, 0xFF, 0x80,
+	0x6E, 0x10, 0x05, 0xCE, 0xD4, 0x8E, 0xA4, 0x00, 0x1E, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD7, 0x31, 0x12, 0x5A, 0xB0, 0x00,
+	0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x28, 0xCE, 0xED, 0x82, 0x00, 0x00,
+	// 'A'
+	0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xCD,
+	0x8F, 0x20, 0x00, 0x00, 0x00, 0x3F, 0x72, 0xF8, 0x00, 0x00, 0x00, 0x09, 0xF1, 0x0C, 0xD0, 0x00,
+	0x00, 0x00, 0xEB, 0x00, 0x6F, 0x40, 0x00, 0x00, 0x5F, 0x50, 0x01, 0xEA, 0x00, 0x00, 0x0B, 0xE0,
+	0x00, 0x09, 0xF1, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC,
+	0x00, 0x0D, 0xE1, 0x00, 0x00, 0x0A, 0xF3, 0x04, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x90, 0xAF, 0x30,
+	0x00, 0x00, 0x00, 0xDE, 0x10,
+	// 'B'
+	0x4F, 0xFF, 0xFF, 0xD9, 0x20, 0x04, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x4F, 0x80, 0x00, 0x3B, 0xF7,
+	0x04, 0xF8, 0x00, 0x00, 0x5F, 0x70, 0x4F, 0x80, 0x00, 0x2B, 0xF3, 0x04, 0xFF, 0xFF, 0xFF, 0xD6,
+	0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x90, 0x04, 0xF8, 0x00, 0x02, 0x9F, 0x90, 0x4F, 0x80, 0x00, 0x00,
+	0xDE, 0x04, 0xF8, 0x00, 0x00, 0x0D, 0xF1, 0x4F, 0x80, 0x00, 0x29, 0xFD, 0x04, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x50, 0x4F, 0xFF, 0xFF, 0xEB, 0x40, 0x00,
+	// 'C'
+	0x00, 0x06, 0xBE, 0xFD, 0xB6, 0x10, 0x2D, 0xFF, 0xFF, 0xFF, 0xF9, 0x0C, 0xFC, 0x51, 0x02, 0x49,
+	0x86, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+	0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFC, 0x51, 0x02, 0x49, 0x80, 0x2D, 0xFF, 0xFF,
+	0xFF, 0xF9, 0x00, 0x17, 0xBE, 0xFD, 0xB6, 0x10,
+	// 'D'
+	0x4F, 0xFF, 0xFE, 0xDA, 0x50, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x4F, 0x80, 0x01, 0x37,
+	0xEF, 0xB0, 0x4F, 0x80, 0x00, 0x00, 0x1D, 0xF4, 0x4F, 0x80, 0x00, 0x00, 0x06, 0xF9, 0x4F, 0x80,
+	0x00, 0x00, 0x02, 0xFB, 0x4F, 0x80, 0x00, 0x00, 0x01, 0xFC, 0x4F, 0x80, 0x00, 0x00, 0x03, 0xFB,
+	0x4F, 0x80, 0x00, 0x00, 0x06, 0xF9, 0x4F, 0x80, 0x00, 0x00, 0x1D, 0xF4, 0x4F, 0x80, 0x01, 0x37,
+	0xEF, 0xB0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x4F, 0xFF, 0xFE, 0xDA, 0x50, 0x00,
+	// 'E'
+	0x4F, 0xFF, 0xFF, 0xFF, 0xF1, 0x4F, 0xFF, 0xFF, 0xFF, 0xF1, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F,
+	0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xC0, 0x4F, 0xFF,
+	0xFF, 0xFF, 0xC0, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+	0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF3, 0x4F, 0xFF, 0xFF, 0xFF,
+	0xF3,
+	// 'F'
+	0x4F, 0xFF, 0xFF, 0xFF, 0x54, 0xFF, 0xFF, 0xFF, 0xF5, 0x4F, 0x80, 0x00, 0x00, 0x04, 0xF8, 0x00,
+	0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xFF, 0xFF, 0xFB, 0x04,
+	0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+	0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00,
+	// 'G'
+	0x00, 0x06, 0xBE, 0xFE, 0xC9, 0x30, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xF2, 0x0C, 0xFC, 0x52, 0x01,
+	0x36, 0xC2, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00,
+	0x00, 0x3F, 0xFF, 0xF7, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xF7, 0xEF, 0x00, 0x00, 0x00, 0x04, 0xF7,
+	0xBF, 0x30, 0x00, 0x00, 0x04, 0xF7, 0x6F, 0xC0, 0x00, 0x00, 0x04, 0xF7, 0x0D, 0xFC, 0x52, 0x01,
+	0x3A, 0xF7, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x06, 0xBE, 0xFE, 0xB5, 0x00,
+	// 'H'
+	0x4F, 0x80, 0x00, 0x00, 0x0F, 0xC4, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x4F, 0x80, 0x00, 0x00, 0x0F,
+	0xC4, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFC, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x4F, 0x80, 0x00, 0x00,
+	0x0F, 0xC4, 0xF8, 0x00, 0x00, 0x00, 0xFC, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0xC4, 0xF8, 0x00, 0x00,
+	0x00, 0xFC, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
+	// 'I'
+	0x4F, 0x84, 0xF8, 0x4F, 0x84, 0xF8, 0x4F, 0x84, 0xF8, 0x4F, 0x84, 0xF8, 0x4F, 0x84, 0xF8, 0x4F,
+	0x84, 0xF8, 0x4F, 0x80,
+	// 'J'
+	0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00,
+	0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F, 0x80, 0x04, 0xF8, 0x00, 0x4F,
+	0x80, 0x06, 0xF7, 0x03, 0xDF, 0x4E, 0xFF, 0xC0, 0xEE, 0xA2, 0x00,
+	// 'K'
+	0x4F, 0x80, 0x00, 0x03, 0xEE, 0x44, 0xF8, 0x00, 0x03, 0xEE, 0x30, 0x4F, 0x80, 0x04, 0xED, 0x20,
+	0x04, 0xF8, 0x05, 0xFD, 0x20, 0x00, 0x4F, 0x86, 0xFC, 0x10, 0x00, 0x04, 0xFD, 0xFB, 0x10, 0x00,
+	0x00, 0x4F, 0xEF, 0xA0, 0x00, 0x00, 0x04, 0xF8, 0xAF, 0xA0, 0x00, 0x00, 0x4F, 0x80, 0xAF, 0xA0,
+	0x00, 0x04, 0xF8, 0x00, 0xAF, 0xA0, 0x00, 0x4F, 0x80, 0x00, 0xAF, 0xA0, 0x04, 0xF8, 0x00, 0x00,
+	0xAF, 0xA0, 0x4F, 0x80, 0x00, 0x00, 0xAF, 0xA0,
+	// 'L'
+	0x4F, 0x80, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x04, 0xF8, 0x00,
+	0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x04,
+	0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+	0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFE, 0x4F, 0xFF, 0xFF, 0xFF, 0xE0,
+	// 'M'
+	0x4F, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0xC4, 0xFE, 0xE1, 0x00, 0x00, 0x7F, 0xFC, 0x4F, 0x9F, 0x60,
+	0x00, 0x0D, 0xAE, 0xC4, 0xF7, 0xBC, 0x00, 0x04, 0xF4, 0xEC, 0x4F, 0x75, 0xF3, 0x00, 0xAD, 0x0E,
+	0xC4, 0xF7, 0x0E, 0x90, 0x1F, 0x70, 0xEC, 0x4F, 0x70, 0x8E, 0x17, 0xF1, 0x0E, 0xC4, 0xF7, 0x02,
+	0xF6, 0xDA, 0x00, 0xEC, 0x4F, 0x70, 0x0B, 0xEF, 0x40, 0x0E, 0xC4, 0xF7, 0x00, 0x5F, 0xD0, 0x00,
+	0xEC, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x0E, 0xC4, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x4F, 0x70,
+	0x00, 0x00, 0x00, 0x0E, 0xC0,
+	// 'N'
+	0x4F, 0xF6, 0x00, 0x00, 0x0F, 0xB4, 0xFF, 0xE1, 0x00, 0x00, 0xFB, 0x4F, 0xCF, 0x70, 0x00, 0x0F,
+	0xB4, 0xF7, 0xCE, 0x10, 0x00, 0xFB, 0x4F, 0x74, 0xF8, 0x00, 0x0F, 0xB4, 0xF7, 0x0B, 0xF2, 0x00,
+	0xFB, 0x4F, 0x70, 0x3F, 0x90, 0x0F, 0xB4, 0xF7, 0x00, 0xAF, 0x30, 0xFB, 0x4F, 0x70, 0x02, 0xFA,
+	0x0F, 0xB4, 0xF7, 0x00, 0x08, 0xF4, 0xFB, 0x4F, 0x70, 0x00, 0x1E, 0xCF, 0xB4, 0xF7, 0x00, 0x00,
+	0x7F, 0xFB, 0x4F, 0x70, 0x00, 0x01, 0xEF, 0xB0,
+	// 'O'
+	0x00, 0x17, 0xCE, 0xED, 0x81, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x0D, 0xFC, 0x41,
+	0x13, 0xAF, 0xE2, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE,
+	0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x2E, 0xF0, 0x00,
+	0x00, 0x00, 0x0C, 0xF1, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F,
+	0x90, 0x1D, 0xFC, 0x41, 0x03, 0xAF, 0xE2, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x17,
+	0xCE, 0xFD, 0x82, 0x00, 0x00,
+	// 'P'
+	0x4F, 0xFF, 0xFE, 0xC6, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x70, 0x4F, 0x80, 0x01, 0x7F, 0xE1, 0x4F,
+	0x80, 0x00, 0x0B, 0xF3, 0x4F, 0x80, 0x00, 0x0B, 0xF3, 0x4F, 0x80, 0x01, 0x7F, 0xE1, 0x4F, 0xFF,
+	0xFF, 0xFF, 0x70, 0x4F, 0xFF, 0xFE, 0xC6, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+	0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00,
+	0x00,
+	// 'Q'
+	0x00, 0x17, 0xCE, 0xED, 0x82, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x0D, 0xFC, 0x41,
+	0x13, 0xAF, 0xE2, 0x06, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0x90, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFE,
+	0x0E, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x2E, 0xF0, 0x00,
+	0x00, 0x00, 0x0C, 0xF0, 0xBF, 0x40, 0x00, 0x00, 0x01, 0xFD, 0x06, 0xFC, 0x00, 0x00, 0x00, 0x9F,
+	0x70, 0x1D, 0xFC, 0x41, 0x03, 0xAF, 0xC1, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x17,
+	0xCE, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+	0x70, 0x00,
+	// 'R'
+	0x4F, 0xFF, 0xFE, 0xC6, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x4F, 0x80, 0x01, 0x6F, 0xF1,
+	0x04, 0xF8, 0x00, 0x00, 0xBF, 0x30, 0x4F, 0x80, 0x00, 0x0B, 0xF2, 0x04, 0xF8, 0x00, 0x16, 0xFD,
+	0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x30, 0x04, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x4F, 0x80, 0x02, 0xBF,
+	0x70, 0x04, 0xF8, 0x00, 0x01, 0xDE, 0x10, 0x4F, 0x80, 0x00, 0x05, 0xF9, 0x04, 0xF8, 0x00, 0x00,
+	0x0B, 0xF2, 0x4F, 0x80, 0x00, 0x00, 0x3F, 0xB0,
+	// 'S'
+	0x02, 0x9D, 0xEE, 0xB6, 0x10, 0x2E, 0xFF, 0xFF, 0xFF, 0xA0, 0x9F, 0xB3, 0x11, 0x38, 0x80, 0xCF,
+	0x10, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x3F, 0xE9, 0x53, 0x00, 0x00, 0x02, 0x9E,
+	0xFF, 0xE8, 0x10, 0x00, 0x00, 0x25, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00,
+	0x08, 0xF6, 0xA8, 0x42, 0x02, 0x6F, 0xF4, 0xCF, 0xFF, 0xFF, 0xFF, 0xB0, 0x27, 0xBD, 0xFE, 0xC6,
+	0x00,
+	// 'T'
+	0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x06,
+	0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0xF6, 0x00, 0x00, 0x00,
+	// 'U'
+	0x7F, 0x50, 0x00, 0x00, 0x3F, 0x97, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x7F, 0x50, 0x00, 0x00, 0x3F,
+	0x97, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x97, 0xF5, 0x00, 0x00, 0x03,
+	0xF9, 0x7F, 0x50, 0x00, 0x00, 0x3F, 0x96, 0xF5, 0x00, 0x00, 0x03, 0xF9, 0x6F, 0x70, 0x00, 0x00,
+	0x4F, 0x83, 0xFB, 0x00, 0x00, 0x08, 0xF6, 0x0D, 0xF9, 0x21, 0x27, 0xFE, 0x10, 0x4F, 0xFF, 0xFF,
+	0xFF, 0x60, 0x00, 0x3A, 0xEF, 0xEB, 0x40, 0x00,
+	// 'V'
+	0xAF, 0x30, 0x00, 0x00, 0x00, 0xDE, 0x14, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x90, 0x0D, 0xE0, 0x00,
+	0x00, 0x0A, 0xF3, 0x00, 0x8F, 0x50, 0x00, 0x01, 0xEC, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x6F, 0x70,
+	0x00, 0x0B, 0xF2, 0x00, 0x0C, 0xF1, 0x00, 0x00, 0x5F, 0x70, 0x02, 0xFA, 0x00, 0x00, 0x00, 0xED,
+	0x00, 0x8F, 0x40, 0x00, 0x00, 0x09, 0xF3, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0x94, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0xCE, 0xBF, 0x20, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+	0x1F, 0xF5, 0x00, 0x00, 0x00,
+	// 'W'
+	0x4F, 0x80, 0x00, 0x03, 0xFF, 0x10, 0x00, 0x0B, 0xF1, 0x1F, 0xC0, 0x00, 0x07, 0xFF, 0x40, 0x00,
+	0x0E, 0xC0, 0x0C, 0xF1, 0x00, 0x0B, 0xBE, 0x80, 0x00, 0x3F, 0x90, 0x08, 0xF4, 0x00, 0x0E, 0x7A,
+	0xC0, 0x00, 0x7F, 0x50, 0x04, 0xF8, 0x00, 0x3F, 0x36, 0xF1, 0x00, 0xBF, 0x10, 0x01, 0xFC, 0x00,
+	0x7E, 0x02, 0xF4, 0x00, 0xEC, 0x00, 0x00, 0xBF, 0x10, 0xBB, 0x00, 0xE8, 0x03, 0xF8, 0x00, 0x00,
+	0x8F, 0x40, 0xE7, 0x00, 0xAC, 0x07, 0xF4, 0x00, 0x00, 0x4F, 0x83, 0xF3, 0x00, 0x6F, 0x1B, 0xF1,
+	0x00, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x3F, 0x4E, 0xC0, 0x00, 0x00, 0x0B, 0xFC, 0xB0, 0x00, 0x0E,
+	0xBF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0x40,
+	0x00, 0x07, 0xFF, 0x10, 0x00,
+	// 'X'
+	0x08, 0xF6, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0xCE, 0x20, 0x00, 0x7F, 0x70, 0x00, 0x3F, 0xB0, 0x03,
+	0xFB, 0x00, 0x00, 0x08, 0xF6, 0x0C, 0xE2, 0x00, 0x00, 0x00, 0xCE, 0xAF, 0x50, 0x00, 0x00, 0x00,
+	0x3F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xDE, 0x20, 0x00,
+	0x00, 0x05, 0xF9, 0x3F, 0xB0, 0x00, 0x00, 0x2E, 0xD1, 0x07, 0xF6, 0x00, 0x00, 0xBF, 0x30, 0x00,
+	0xCE, 0x20, 0x06, 0xF7, 0x00, 0x00, 0x3F, 0xB0, 0x2E, 0xC0, 0x00, 0x00, 0x07, 0xF6,
+	// 'Y'
+	0xAF, 0x30, 0x00, 0x00, 0x3F, 0xA1, 0xED, 0x10, 0x00, 0x1D, 0xE1, 0x05, 0xF9, 0x00, 0x08, 0xF5,
+	0x00, 0x0A, 0xF4, 0x04, 0xFA, 0x00, 0x00, 0x1E, 0xD2, 0xDD, 0x10, 0x00, 0x00, 0x4F, 0xEF, 0x40,
+	0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60,
+	0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x06, 0xF6,
+	0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00,
+	// 'Z'
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+	0x5F, 0x40, 0x00, 0x00, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x90, 0x00, 0x00, 0x00,
+	0x01, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x20, 0x00, 0x00,
+	0x00, 0x07, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x03, 0xE7, 0x00, 0x00,
+	0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+	// '['
+	0x7F, 0xFF, 0x47, 0xFF, 0xF4, 0x7F, 0x30, 0x07, 0xF3, 0x00, 0x7F, 0x30, 0x07, 0xF3, 0x00, 0x7F,
+	0x30, 0x07, 0xF3, 0x00, 0x7F, 0x30, 0x07, 0xF3, 0x00, 0x7F, 0x30, 0x07, 0xF3, 0x00, 0x7F, 0x30,
+	0x07, 0xF3, 0x00, 0x7F, 0xFF, 0x47, 0xFF, 0xF4,
+	// 0x5C
+	0xDA, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0E, 0x80, 0x00, 0x09, 0xD0, 0x00, 0x05,
+	0xF3, 0x00, 0x01, 0xF7, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x2F, 0x60, 0x00, 0x0C,
+	0xA0, 0x00, 0x07, 0xE1, 0x00, 0x03, 0xF5, 0x00, 0x00, 0xD9, 0x00, 0x00, 0x9E,
+	// ']'
+	0x4F, 0xFF, 0x74, 0xFF, 0xF7, 0x00, 0x2F, 0x70, 0x02, 0xF7, 0x00, 0x2F, 0x70, 0x02, 0xF7, 0x00,
+	0x2F, 0x70, 0x02, 0xF7, 0x00, 0x2F, 0x70, 0x02, 0xF7, 0x00, 0x2F, 0x70, 0x02, 0xF7, 0x00, 0x2F,
+	0x70, 0x02, 0xF7, 0x4F, 0xFF, 0x74, 0xFF, 0xF7,
+	// '^'
+	0x00, 0x01, 0xBF, 0xC1, 0x00, 0x00, 0x00, 0xBF, 0xAF, 0xC1, 0x00, 0x00, 0xAF, 0x60, 0x5F, 0xB1,
+	0x00, 0xAF, 0x50, 0x00, 0x4E, 0xB0, 0x9E, 0x40, 0x00, 0x00, 0x3E, 0xA0,
+	// '_'
+	0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+	// '`'
+	0x2D, 0xA0, 0x00, 0x2E, 0x70, 0x00, 0x3E, 0x40,
+	// 'a'
+	0x05, 0xBE, 0xFC, 0x60, 0x03, 0xFF, 0xFF, 0xFF, 0x70, 0x3A, 0x41, 0x14, 0xDE, 0x10, 0x00, 0x00,
+	0x05, 0xF4, 0x06, 0xBE, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0xF6, 0xDE, 0x41, 0x00, 0x5F, 0x6D,
+	0xD3, 0x01, 0x5D, 0xF6, 0x8F, 0xFF, 0xFF, 0xAF, 0x60, 0x8D, 0xFD, 0x63, 0xF6,
+	// 'b'
+	0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F,
+	0x40, 0x00, 0x00, 0x00, 0x5F, 0x46, 0xDF, 0xC5, 0x00, 0x5F, 0xAF, 0xFF, 0xFF, 0x60, 0x5F, 0xF7,
+	0x11, 0x7F, 0xE0, 0x5F, 0x90, 0x00, 0x09, 0xF4, 0x5F, 0x50, 0x00, 0x05, 0xF6, 0x5F, 0x50, 0x00,
+	0x05, 0xF6, 0x5F, 0x90, 0x00, 0x09, 0xF4, 0x5F, 0xF7, 0x11, 0x7F, 0xE0, 0x5F, 0xAF, 0xFF, 0xFF,
+	0x60, 0x5F, 0x46, 0xDF, 0xC5, 0x00,
+	// 'c'
+	0x00, 0x7C, 0xFE, 0xA2, 0x0B, 0xFF, 0xFF, 0xFC, 0x7F, 0xD4, 0x11, 0x59, 0xCF, 0x20, 0x00, 0x00,
+	0xEC, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x7F, 0xD4, 0x11, 0x59,
+	0x0C, 0xFF, 0xFF, 0xFC, 0x00, 0x7D, 0xFD, 0xA2,
+	// 'd'
+	0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,
+	0x00, 0xCC, 0x02, 0xAE, 0xEA, 0x1C, 0xC1, 0xDF, 0xFF, 0xFC, 0xDC, 0x8F, 0xB3, 0x14, 0xDF, 0xCD,
+	0xE1, 0x00, 0x03, 0xFC, 0xFB, 0x00, 0x00, 0x0E, 0xCF, 0xB0, 0x00, 0x00, 0xEC, 0xDE, 0x10, 0x00,
+	0x3F, 0xC8, 0xFB, 0x31, 0x4D, 0xFC, 0x1D, 0xFF, 0xFF, 0xCD, 0xC0, 0x2A, 0xEE, 0xA1, 0xCC,
+	// 'e'
+	0x00, 0x7D, 0xFE, 0xA2, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x20, 0x7F, 0xB3, 0x11, 0x7F, 0xA0, 0xCE,
+	0x00, 0x00, 0x09, 0xE0, 0xEF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xCD, 0x00,
+	0x00, 0x00, 0x00, 0x7F, 0xA3, 0x11, 0x37, 0x90, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x6C, 0xEE,
+	0xC8, 0x20,
+	// 'f'
+	0x00, 0x1A, 0xEF, 0xA0, 0x0A, 0xFF, 0xFA, 0x00, 0xEC, 0x10, 0x00, 0x0F, 0x90, 0x00, 0x9F, 0xFF,
+	0xFF, 0x49, 0xFF, 0xFF, 0xF4, 0x01, 0xF9, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x01, 0xF9, 0x00, 0x00,
+	0x1F, 0x90, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x1F, 0x90,
+	0x00,
+	// 'g'
+	0x02, 0xAE, 0xEA, 0x1C, 0xC1, 0xDF, 0xFF, 0xFC, 0xDC, 0x8F, 0xB3, 0x14, 0xDF, 0xCD, 0xE1, 0x00,
+	0x03, 0xFC, 0xFB, 0x00, 0x00, 0x0E, 0xCF, 0xB0, 0x00, 0x00, 0xEC, 0xDE, 0x10, 0x00, 0x2F, 0xC8,
+	0xFB, 0x21, 0x3C, 0xFC, 0x1D, 0xFF, 0xFF, 0xCD, 0xC0, 0x2A, 0xEE, 0xA1, 0xEB, 0x00, 0x00, 0x00,
+	0x4F, 0x80, 0x94, 0x11, 0x5D, 0xF4, 0x0C, 0xFF, 0xFF, 0xFA, 0x00, 0x3A, 0xDF, 0xD7, 0x00,
+	// 'h'
+	0x5F, 0x40, 0x00, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x05, 0xF4, 0x00,
+	0x00, 0x00, 0x5F, 0x45, 0xDF, 0xD5, 0x05, 0xFA, 0xFF, 0xFF, 0xF4, 0x5F, 0xF6, 0x11, 0x7F, 0xA5,
+	0xF8, 0x00, 0x00, 0xDC, 0x5F, 0x40, 0x00, 0x0B, 0xD5, 0xF4, 0x00, 0x00, 0xBD, 0x5F, 0x40, 0x00,
+	0x0B, 0xD5, 0xF4, 0x00, 0x00, 0xBD, 0x5F, 0x40, 0x00, 0x0B, 0xD5, 0xF4, 0x00, 0x00, 0xBD,
+	// 'i'
+	0x4F, 0x54, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F,
+	0x54, 0xF5, 0x4F, 0x54, 0xF5,
+	// 'j'
+	0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00,
+	0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F, 0x50, 0x04, 0xF5, 0x00, 0x4F,
+	0x50, 0x04, 0xF5, 0x00, 0x5F, 0x40, 0x1A, 0xF2, 0x5F, 0xFD, 0x05, 0xEB, 0x20,
+	// 'k'
+	0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F,
+	0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x7F, 0x90, 0x5F, 0x40, 0x09, 0xF7, 0x00, 0x5F, 0x40,
+	0xAF, 0x60, 0x00, 0x5F, 0x5B, 0xE4, 0x00, 0x00, 0x5F, 0xEF, 0x40, 0x00, 0x00, 0x5F, 0x9F, 0xB1,
+	0x00, 0x00, 0x5F, 0x45, 0xFB, 0x10, 0x00, 0x5F, 0x40, 0x5F, 0xC1, 0x00, 0x5F, 0x40, 0x04, 0xFC,
+	0x10, 0x5F, 0x40, 0x00, 0x4F, 0xC1,
+	// 'l'
+	0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F, 0x54, 0xF5, 0x4F,
+	0x54, 0xF5, 0x4F, 0x54, 0xF5,
+	// 'm'
+	0x5F, 0x46, 0xDE, 0xC3, 0x03, 0xBE, 0xE7, 0x05, 0xFA, 0xFF, 0xFF, 0xE3, 0xEF, 0xFF, 0xF5, 0x5F,
+	0xF6, 0x11, 0xAF, 0xEA, 0x21, 0x5F, 0xB5, 0xF8, 0x00, 0x02, 0xFD, 0x00, 0x00, 0xBE, 0x5F, 0x40,
+	0x00, 0x0F, 0xA0, 0x00, 0x09, 0xF5, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F, 0x5F, 0x40, 0x00,
+	0x0F, 0xA0, 0x00, 0x09, 0xF5, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F, 0x5F, 0x40, 0x00, 0x0F,
+	0xA0, 0x00, 0x09, 0xF5, 0xF4, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x9F,
+	// 'n'
+	0x5F, 0x45, 0xDF, 0xD5, 0x05, 0xFA, 0xFF, 0xFF, 0xF4, 0x5F, 0xF6, 0x11, 0x7F, 0xA5, 0xF8, 0x00,
+	0x00, 0xDC, 0x5F, 0x40, 0x00, 0x0B, 0xD5, 0xF4, 0x00, 0x00, 0xBD, 0x5F, 0x40, 0x00, 0x0B, 0xD5,
+	0xF4, 0x00, 0x00, 0xBD, 0x5F, 0x40, 0x00, 0x0B, 0xD5, 0xF4, 0x00, 0x00, 0xBD,
+	// 'o'
+	0x01, 0x9D, 0xFD, 0x91, 0x01, 0xDF, 0xFF, 0xFF, 0xD1, 0x8F, 0xC3, 0x13, 0xCF, 0x8D, 0xE1, 0x00,
+	0x01, 0xED, 0xFC, 0x00, 0x00, 0x0C, 0xFF, 0xC0, 0x00, 0x00, 0xCF, 0xDE, 0x10, 0x00, 0x1E, 0xD8,
+	0xFC, 0x31, 0x3C, 0xF8, 0x1D, 0xFF, 0xFF, 0xFD, 0x10, 0x19, 0xDF, 0xD9, 0x10,
+	// 'p'
+	0x5F, 0x46, 0xDF, 0xC5, 0x00, 0x5F, 0xAF, 0xFF, 0xFF, 0x60, 0x5F, 0xF7, 0x11, 0x7F, 0xE0, 0x5F,
+	0x90, 0x00, 0x09, 0xF4, 0x5F, 0x50, 0x00, 0x05, 0xF6, 0x5F, 0x50, 0x00, 0x05, 0xF6, 0x5F, 0x90,
+	0x00, 0x09, 0xF4, 0x5F, 0xF7, 0x11, 0x7F, 0xE0, 0x5F, 0xAF, 0xFF, 0xFF, 0x60, 0x5F, 0x46, 0xDF,
+	0xC5, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x00,
+	0x00, 0x5F, 0x40, 0x00, 0x00, 0x00,
+	// 'q'
+	0x02, 0xAE, 0xEA, 0x1C, 0xC1, 0xDF, 0xFF, 0xFC, 0xDC, 0x8F, 0xB3, 0x14, 0xDF, 0xCD, 0xE1, 0x00,
+	0x03, 0xFC, 0xFB, 0x00, 0x00, 0x0E, 0xCF, 0xB0, 0x00, 0x00, 0xEC, 0xDE, 0x10, 0x00, 0x3F, 0xC8,
+	0xFB, 0x31, 0x4D, 0xFC, 0x1D, 0xFF, 0xFF, 0xCD, 0xC0, 0x2A, 0xEE, 0xA1, 0xCC, 0x00, 0x00, 0x00,
+	0x0C, 0xC0, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0xCC,
+	// 'r'
+	0x5F, 0x46, 0xDF, 0x65, 0xFA, 0xFF, 0xF6, 0x5F, 0xF7, 0x10, 0x05, 0xF9, 0x00, 0x00, 0x5F, 0x50,
+	0x00, 0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x05,
+	0xF4, 0x00, 0x00,
+	// 's'
+	0x07, 0xDE, 0xEB, 0x40, 0x9F, 0xFF, 0xFF, 0xF0, 0xDD, 0x31, 0x14, 0xB0, 0xCB, 0x00, 0x00, 0x00,
+	0x4E, 0xC8, 0x51, 0x00, 0x01, 0x48, 0xBE, 0x90, 0x00, 0x00, 0x04, 0xF5, 0xC5, 0x20, 0x29, 0xF7,
+	0xFF, 0xFF, 0xFF, 0xE2, 0x39, 0xDF, 0xDA, 0x30,
+	// 't'
+	0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x08, 0xFF, 0xFF, 0xF9, 0x8F, 0xFF,
+	0xFF, 0x90, 0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x00, 0x5F, 0x40, 0x00, 0x05, 0xF4, 0x00, 0x00,
+	0x5F, 0x50, 0x00, 0x04, 0xF9, 0x10, 0x00, 0x1E, 0xFF, 0xF9, 0x00, 0x5C, 0xFF, 0x90,
+	// 'u'
+	0x7F, 0x20, 0x00, 0x0D, 0xC7, 0xF2, 0x00, 0x00, 0xDC, 0x7F, 0x20, 0x00, 0x0D, 0xC7, 0xF2, 0x00,
+	0x00, 0xDC, 0x7F, 0x20, 0x00, 0x0D, 0xC7, 0xF2, 0x00, 0x00, 0xDC, 0x6F, 0x40, 0x00, 0x2F, 0xC3,
+	0xFC, 0x21, 0x3C, 0xFC, 0x0C, 0xFF, 0xFF, 0xCD, 0xC0, 0x2A, 0xEE, 0x91, 0xDC,
+	// 'v'
+	0x4F, 0x60, 0x00, 0x00, 0xCE, 0x0E, 0xC0, 0x00, 0x02, 0xF8, 0x08, 0xF2, 0x00, 0x08, 0xF3, 0x03,
+	0xF8, 0x00, 0x0D, 0xC0, 0x00, 0xCD, 0x00, 0x4F, 0x70, 0x00, 0x7F, 0x40, 0x9F, 0x10, 0x00, 0x1F,
+	0xA1, 0xEB, 0x00, 0x00, 0x0A, 0xE6, 0xF5, 0x00, 0x00, 0x05, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0xEF,
+	0x90, 0x00,
+	// 'w'
+	0x2F, 0x80, 0x00, 0xBF, 0x70, 0x00, 0xCD, 0x0D, 0xB0, 0x00, 0xEF, 0xB0, 0x01, 0xF9, 0x09, 0xF1,
+	0x04, 0xFA, 0xE0, 0x05, 0xF5, 0x05, 0xF4, 0x08, 0xE3, 0xF3, 0x08, 0xF1, 0x01, 0xF8, 0x0B, 0xA0,
+	0xE7, 0x0C, 0xC0, 0x00, 0xDC, 0x1F, 0x60, 0xAB, 0x1F, 0x80, 0x00, 0x9F, 0x5F, 0x20, 0x6F, 0x5F,
+	0x40, 0x00, 0x5F, 0xDD, 0x00, 0x2F, 0xDF, 0x10, 0x00, 0x1F, 0xF9, 0x00, 0x0E, 0xFC, 0x00, 0x00,
+	0x0C, 0xF5, 0x00, 0x0A, 0xF8, 0x00,
+	// 'x'
+	0x0C, 0xE2, 0x00, 0x06, 0xF8, 0x02, 0xEC, 0x00, 0x3E, 0xB0, 0x00, 0x5F, 0x91, 0xCE, 0x20, 0x00,
+	0x09, 0xFC, 0xF5, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x00, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x1D,
+	0xE7, 0xF8, 0x00, 0x00, 0xAF, 0x40, 0xAF, 0x40, 0x06, 0xF8, 0x00, 0x1D, 0xD1, 0x2E, 0xC0, 0x00,
+	0x03, 0xFA,
+	// 'y'
+	0x4F, 0x70, 0x00, 0x00, 0xCD, 0x0D, 0xD0, 0x00, 0x03, 0xF7, 0x07, 0xF3, 0x00, 0x09, 0xF2, 0x01,
+	0xF9, 0x00, 0x1E, 0xA0, 0x00, 0x9E, 0x10, 0x5F, 0x40, 0x00, 0x3F, 0x60, 0xBD, 0x00, 0x00, 0x0C,
+	0xC2, 0xF7, 0x00, 0x00, 0x06, 0xFB, 0xF1, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x9F,
+	0x30, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00,
+	0x00, 0x09, 0xFD, 0x40, 0x00, 0x00,
+	// 'z'
+	0x0F, 0xFF, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00,
+	0x8B, 0x00, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x00, 0x5C, 0x10, 0x00, 0x00, 0x4D, 0x10, 0x00, 0x00,
+	0x3D, 0x20, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xFF, 0xFA,
+	// '{'
+	0x00, 0x02, 0xAE, 0xF3, 0x00, 0x0B, 0xFF, 0xF3, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0x0F, 0x90, 0x00,
+	0x00, 0x0F, 0x90, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x01, 0x8F, 0x70, 0x00, 0xBF, 0xFB, 0x10, 0x00,
+	0xBF, 0xFA, 0x10, 0x00, 0x01, 0xAF, 0x60, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x0F, 0x90, 0x00,
+	0x00, 0x0F, 0x90, 0x00, 0x00, 0x0F, 0xA0, 0x00, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0x0A, 0xFF, 0xF3,
+	0x00, 0x02, 0xAE, 0xF3,
+	// '|'
+	0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC,
+	0xBC, 0xBC,
+	// '}'
+	0xBE, 0xC6, 0x00, 0x00, 0xBF, 0xFF, 0x20, 0x00, 0x01, 0x7F, 0x60, 0x00, 0x00, 0x3F, 0x70, 0x00,
+	0x00, 0x2F, 0x70, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, 0x1F, 0xD2, 0x00, 0x00, 0x06, 0xEF, 0xF3,
+	0x00, 0x05, 0xEF, 0xF3, 0x00, 0x0E, 0xE4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x2F, 0x70, 0x00,
+	0x00, 0x2F, 0x70, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x01, 0x8F, 0x50, 0x00, 0xBF, 0xFF, 0x20, 0x00,
+	0xBF, 0xC5, 0x00, 0x00,
+	// '~'
+	0x01, 0x9E, 0xFC, 0x84, 0x11, 0x4C, 0x31, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x1D, 0x61, 0x14,
+	0x8C, 0xEE, 0x92, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const TFT_GFXglyph_t DejaVuSans18Glyphs[] = {
+	{0, 0, 0, 6, 0, 0}, // ' '
+	{0, 3, 13, 7, 2, -13}, // '!'
+	{20, 6, 5, 8, 1, -13}, // '"'
+	{35, 13, 14, 15, 1, -14}, // '#'
+	{126, 9, 17, 11, 1, -14}, // '$'
+	{203, 16, 13, 17, 1, -13}, // '%'
+	{307, 13, 13, 14, 1, -13}, // '&'
+	{392, 3, 5, 5, 1, -13}, // 0x27
+	{400, 5, 16, 7, 1, -14}, // '('
+	{440, 5, 16, 7, 1, -14}, // ')'
+	{480, 9, 8, 9, 0, -13}, // '*'
+	{516, 13, 12, 15, 1, -12}, // '+'
+	{594, 3, 4, 6, 1, -2}, // ','
+	{600, 6, 2, 7, 0, -6}, // '-'
+	{606, 3, 2, 6, 1, -2}, // '.'
+	{609, 6, 15, 6, 0, -13}, // '/'
+	{654, 10, 13, 11, 1, -13}, // '0'
+	{719, 8, 13, 11, 2, -13}, // '1'
+	{771, 9, 13, 11, 1, -13}, // '2'
+	{830, 9, 13, 11, 1, -13}, // '3'
+	{889, 11, 13, 11, 0, -13}, // '4'
+	{961, 9, 13, 11, 1, -13}, // '5'
+	{1020, 10, 13, 11, 1, -13}, // '6'
+	{1085, 9, 13, 11, 1, -13}, // '7'
+	{1144, 10, 13, 11, 1, -13}, // '8'
+	{1209, 10, 13, 11, 1, -13}, // '9'
+	{1274, 2, 9, 6, 2, -9}, // ':'
+	{1283, 3, 11, 6, 1, -9}, // ';'
+	{1300, 13, 10, 15, 1, -10}, // '<'
+	{1365, 13, 6, 15, 1, -9}, // '='
+	{1404, 13, 10, 15, 1, -10}, // '>'
+	{1469, 8, 13, 10, 1, -13}, // '?'
+	{1521, 16, 16, 18, 1, -13}, // '@'
+	{1649, 13, 13, 12, 0, -13}, // 'A'
+	{1734, 11, 13, 12, 1, -13}, // 'B'
+	{1806, 11, 13, 13, 1, -13}, // 'C'
+	{1878, 12, 13, 14, 1, -13}, // 'D'
+	{1956, 10, 13, 11, 1, -13}, // 'E'
+	{2021, 9, 13, 10, 1, -13}, // 'F'
+	{2080, 12, 13, 14, 1, -13}, // 'G'
+	{2158, 11, 13, 14, 1, -13}, // 'H'
+	{2230, 3, 13, 5, 1, -13}, // 'I'
+	{2250, 5, 17, 5, -1, -13}, // 'J'
+	{2293, 11, 13, 12, 1, -13}, // 'K'
+	{2365, 9, 13, 10, 1, -13}, // 'L'
+	{2424, 13, 13, 16, 1, -13}, // 'M'
+	{2509, 11, 13, 13, 1, -13}, // 'N'
+	{2581, 13, 13, 14, 1, -13}, // 'O'
+	{2666, 10, 13, 11, 1, -13}, // 'P'
+	{2731, 13, 15, 14, 1, -13}, // 'Q'
+	{2829, 11, 13, 13, 1, -13}, // 'R'
+	{2901, 10, 13, 11, 1, -13}, // 'S'
+	{2966, 13, 13, 11, -1, -13}, // 'T'
+	{3051, 11, 13, 13, 1, -13}, // 'U'
+	{3123, 13, 13, 12, 0, -13}, // 'V'
+	{3208, 18, 13, 18, 0, -13}, // 'W'
+	{3325, 12, 13, 12, 0, -13}, // 'X'
+	{3403, 11, 13, 11, 0, -13}, // 'Y'
+	{3475, 12, 13, 12, 0, -13}, // 'Z'
+	{3553, 5, 16, 7, 1, -14}, // '['
+	{3593, 6, 15, 6, 0, -13}, // 0x5C
+	{3638, 5, 16, 7, 1, -14}, // ']'
+	{3678, 11, 5, 15, 2, -13}, // '^'
+	{3706, 11, 2, 9, -1, 2}, // '_'
+	{3717, 5, 3, 9, 1, -14}, // '`'
+	{3725, 9, 10, 11, 1, -10}, // 'a'
+	{3770, 10, 14, 11, 1, -14}, // 'b'
+	{3840, 8, 10, 10, 1, -10}, // 'c'
+	{3880, 9, 14, 11, 1, -14}, // 'd'
+	{3943, 10, 10, 11, 1, -10}, // 'e'
+	{3993, 7, 14, 6, 0, -14}, // 'f'
+	{4042, 9, 14, 11, 1, -10}, // 'g'
+	{4105, 9, 14, 11, 1, -14}, // 'h'
+	{4168, 3, 14, 5, 1, -14}, // 'i'
+	{4189, 5, 18, 5, -1, -14}, // 'j'
+	{4234, 10, 14, 10, 1, -14}, // 'k'
+	{4304, 3, 14, 5, 1, -14}, // 'l'
+	{4325, 15, 10, 18, 1, -10}, // 'm'
+	{4400, 9, 10, 11, 1, -10}, // 'n'
+	{4445, 9, 10, 11, 1, -10}, // 'o'
+	{4490, 10, 14, 11, 1, -10}, // 'p'
+	{4560, 9, 14, 11, 1, -10}, // 'q'
+	{4623, 7, 10, 7, 1, -10}, // 'r'
+	{4658, 8, 10, 9, 1, -10}, // 's'
+	{4698, 7, 13, 7, 0, -13}, // 't'
+	{4744, 9, 10, 11, 1, -10}, // 'u'
+	{4789, 10, 10, 11, 0, -10}, // 'v'
+	{4839, 14, 10, 15, 0, -10}, // 'w'
+	{4909, 10, 10, 11, 0, -10}, // 'x'
+	{4959, 10, 14, 11, 0, -10}, // 'y'
+	{5029, 9, 10, 9, 0, -10}, // 'z'
+	{5074, 8, 17, 11, 2, -14}, // '{'
+	{5142, 2, 18, 6, 2, -14}, // '|'
+	{5160, 8, 17, 11, 2, -14}, // '}'
+	{5228, 13, 4, 15, 1, -8}, // '~'
+};
+
+static const TFT_GFXfont_t DejaVuSans18 = {DejaVuSans18Bitmaps, DejaVuSans18Glyphs, 0x20, 0x7E, 22, nullptr, 0, 4, false};
@@ -0,0 +1,133 @@
+/*!
+	@file     DejaVuSansBold40.hpp
+	@brief    DejaVuSansBold40 proportional font for the ST7789_TFT_PICO library,
+			  from DejaVuSans-Bold.ttf, 11 glyphs, 2 bpp, run length encoded.
+	@note     Generated by extra/tools/font_compiler.py, do not edit.
+*/
+
+#pragma once
+
+#include "st7789/ST7789_TFT_Font.hpp"
+
+static const uint8_t DejaVuSansBold40Bitmaps[] = {
+	// '0'
+	0x06, 0x40, 0x81, 0xC3, 0x80, 0x41, 0x0B, 0x40, 0x80, 0xC9, 0x80, 0x09, 0x80, 0xCD, 0x40, 0x06,
+	0x80, 0xCF, 0x40, 0x04, 0x40, 0xD1, 0x40, 0x03, 0xC6, 0x80, 0x40, 0x01, 0x40, 0xC6, 0x80, 0x02,
+	0x40, 0xC6, 0x05, 0xC6, 0x40, 0x01, 0xC6, 0x40, 0x05, 0x80, 0xC5, 0x80, 0x00, 0x40, 0xC6, 0x06,
+	0x40, 0xC6, 0x00, 0x40, 0xC6, 0x07, 0xC6, 0x40, 0x80, 0xC5, 0x80, 0x07, 0xC6, 0x80, 0xC6, 0x80,
+	0x07, 0x80, 0xC5, 0x80, 0xC6, 0x80, 0x07, 0x80, 0xC5, 0x80, 0xC6, 0x40, 0x07, 0x80, 0xCD, 0x40,
+	0x07, 0x80, 0xCD, 0x40, 0x07, 0x80, 0xCD, 0x40, 0x07, 0x80, 0xCD, 0x80, 0x07, 0x80, 0xC5, 0x80,
+	0xC6, 0x80, 0x07, 0x80, 0xC5, 0x81, 0xC5, 0x80, 0x07, 0xC6, 0x80, 0x40, 0xC6, 0x07, 0xC6, 0x41,
+	0xC6, 0x06, 0x40, 0xC6, 0x01, 0xC6, 0x40, 0x05, 0x80, 0xC5, 0x80, 0x01, 0x40, 0xC6, 0x05, 0xC6,
+	0x40, 0x02, 0xC6, 0x80, 0x40, 0x01, 0x40, 0xC6, 0x80, 0x03, 0x40, 0xD1, 0x40, 0x04, 0x80, 0xCF,
+	0x40, 0x06, 0x80, 0xCD, 0x40, 0x08, 0x40, 0x80, 0xC9, 0x80, 0x0C, 0x40, 0x81, 0xC3, 0x80, 0x41,
+	0x06,
+	// '1'
+	0x01, 0x41, 0x81, 0xC7, 0x40, 0x05, 0x40, 0xCC, 0x40, 0x05, 0x40, 0xCC, 0x40, 0x05, 0x40, 0xCC,
+	0x40, 0x05, 0x40, 0xCC, 0x40, 0x05, 0x40, 0xC0, 0x81, 0x41, 0x00, 0x80, 0xC5, 0x40, 0x0C, 0x80,
+	0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80,
+	0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80,
+	0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80,
+	0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x0C, 0x80,
+	0xC5, 0x40, 0x0C, 0x80, 0xC5, 0x40, 0x05, 0x40, 0xD3, 0x40, 0xD3, 0x40, 0xD3, 0x40, 0xD3, 0x40,
+	0xD3,
+	// '2'
+	0x03, 0x40, 0x82, 0xC4, 0x80, 0x40, 0x07, 0x40, 0x80, 0xCC, 0x80, 0x40, 0x03, 0x80, 0xD0, 0x40,
+	0x02, 0x80, 0xD1, 0x40, 0x01, 0x80, 0xD2, 0x01, 0x80, 0xC3, 0x80, 0x40, 0x02, 0x40, 0x80, 0xC7,
+	0x80, 0x00, 0x80, 0xC0, 0x80, 0x40, 0x07, 0x80, 0xC7, 0x00, 0x80, 0x40, 0x0A, 0xC7, 0x0D, 0x80,
+	0xC6, 0x0D, 0x40, 0xC6, 0x0D, 0x80, 0xC6, 0x0D, 0x80, 0xC5, 0x80, 0x0C, 0x40, 0xC6, 0x40, 0x0B,
+	0x40, 0xC6, 0x80, 0x0B, 0x40, 0xC6, 0x80, 0x0B, 0x40, 0xC7, 0x0B, 0x40, 0xC7, 0x0B, 0x40, 0xC6,
+	0x80, 0x0B, 0x80, 0xC6, 0x80, 0x0B, 0x80, 0xC6, 0x80, 0x0B, 0x80, 0xC6, 0x80, 0x0B, 0xC7, 0x40,
+	0x0A, 0x40, 0xC7, 0x40, 0x0A, 0x40, 0xC7, 0x40, 0x0B, 0x80, 0xD3, 0x40, 0x80, 0xD3, 0x40, 0x80,
+	0xD3, 0x40, 0x80, 0xD3, 0x40, 0x80, 0xD3, 0x40, 0x80, 0xD3, 0x40,
+	// '3'
+	0x02, 0x41, 0x82, 0xC5, 0x81, 0x40, 0x07, 0xCF, 0x40, 0x05, 0xD0, 0x80, 0x04, 0xD1, 0x80, 0x03,
+	0xD2, 0x40, 0x02, 0xC2, 0x80, 0x40, 0x03, 0x40, 0x80, 0xC7, 0x80, 0x02, 0x80, 0x40, 0x08, 0x40,
+	0xC7, 0x0E, 0x80, 0xC6, 0x0E, 0x80, 0xC6, 0x0E, 0x80, 0xC5, 0x80, 0x0D, 0x40, 0xC6, 0x40, 0x0B,
+	0x40, 0x80, 0xC6, 0x80, 0x06, 0x40, 0xCC, 0x80, 0x07, 0x40, 0xCA, 0x80, 0x09, 0x40, 0xCB, 0x80,
+	0x08, 0x40, 0xCD, 0x40, 0x06, 0x40, 0xCE, 0x40, 0x0B, 0x40, 0x80, 0xC7, 0x80, 0x0E, 0x80, 0xC6,
+	0x40, 0x0D, 0x40, 0xC6, 0x40, 0x0E, 0xC6, 0x80, 0x0E, 0xC6, 0x80, 0x0D, 0x40, 0xC6, 0x80, 0x40,
+	0x80, 0x40, 0x0A, 0x80, 0xC6, 0x41, 0xC2, 0x80, 0x41, 0x03, 0x40, 0x80, 0xC8, 0x00, 0x40, 0xD3,
+	0x40, 0x00, 0x40, 0xD2, 0x80, 0x01, 0x40, 0xD1, 0x80, 0x02, 0x40, 0xCF, 0x80, 0x40, 0x05, 0x41,
+	0x82, 0xC5, 0x81, 0x40, 0x06,
+	// '4'
+	0x0B, 0x80, 0xC7, 0x0E, 0x80, 0xC8, 0x0D, 0x40, 0xC9, 0x0D, 0xCA, 0x0C, 0x80, 0xCA, 0x0B, 0x40,
+	0xCB, 0x0B, 0xC4, 0x80, 0xC6, 0x0A, 0x80, 0xC3, 0x80, 0x40, 0xC6, 0x09, 0x40, 0xC4, 0x00, 0x40,
+	0xC6, 0x09, 0xC4, 0x40, 0x00, 0x40, 0xC6, 0x08, 0x80, 0xC3, 0x80, 0x01, 0x40, 0xC6, 0x07, 0x80,
+	0xC4, 0x02, 0x40, 0xC6, 0x06, 0x40, 0xC4, 0x40, 0x02, 0x40, 0xC6, 0x06, 0xC4, 0x80, 0x03, 0x40,
+	0xC6, 0x05, 0x80, 0xC4, 0x04, 0x40, 0xC6, 0x04, 0x40, 0xC4, 0x40, 0x04, 0x40, 0xC6, 0x04, 0xC4,
+	0x80, 0x05, 0x40, 0xC6, 0x03, 0x40, 0xC3, 0x80, 0x06, 0x40, 0xC6, 0x03, 0x40, 0xD7, 0x40, 0xD7,
+	0x40, 0xD7, 0x40, 0xD7, 0x40, 0xD7, 0x0C, 0x40, 0xC6, 0x10, 0x40, 0xC6, 0x10, 0x40, 0xC6, 0x10,
+	0x40, 0xC6, 0x10, 0x40, 0xC6, 0x10, 0x40, 0xC6, 0x03,
+	// '5'
+	0x00, 0x80, 0xD1, 0x02, 0x80, 0xD1, 0x02, 0x80, 0xD1, 0x02, 0x80, 0xD1, 0x02, 0x80, 0xD1, 0x02,
+	0x80, 0xD1, 0x02, 0x80, 0xC4, 0x40, 0x0E, 0x80, 0xC4, 0x40, 0x0E, 0x80, 0xC4, 0x40, 0x0E, 0x80,
+	0xC4, 0x81, 0xC3, 0x81, 0x40, 0x06, 0x80, 0xCE, 0x40, 0x04, 0x80, 0xCF, 0x80, 0x03, 0x80, 0xD0,
+	0x80, 0x02, 0x80, 0xD1, 0x80, 0x01, 0x80, 0xC1, 0x80, 0x41, 0x02, 0x40, 0x80, 0xC8, 0x01, 0x80,
+	0x40, 0x09, 0xC7, 0x40, 0x0D, 0xC6, 0x80, 0x0D, 0x80, 0xC6, 0x0D, 0x80, 0xC6, 0x0D, 0x80, 0xC6,
+	0x0D, 0x80, 0xC6, 0x80, 0x40, 0x0B, 0xC6, 0x80, 0xC1, 0x80, 0x40, 0x08, 0xC7, 0x40, 0xC3, 0x81,
+	0x40, 0x02, 0x40, 0x80, 0xC8, 0x00, 0xD3, 0x40, 0x00, 0xD2, 0x80, 0x01, 0xD1, 0x80, 0x03, 0x80,
+	0xCD, 0x80, 0x40, 0x07, 0x40, 0x81, 0xC4, 0x81, 0x40, 0x06,
+	// '6'
+	0x08, 0x40, 0x81, 0xC3, 0x81, 0x40, 0x0B, 0x80, 0xCB, 0x80, 0x07, 0x40, 0xCE, 0x80, 0x05, 0x40,
+	0xCF, 0x80, 0x04, 0x40, 0xD0, 0x80, 0x04, 0x80, 0xC6, 0x80, 0x40, 0x03, 0x40, 0x80, 0xC1, 0x80,
+	0x03, 0x80, 0xC6, 0x40, 0x08, 0x40, 0x80, 0x03, 0xC6, 0x40, 0x0E, 0x40, 0xC5, 0x80, 0x0F, 0x80,
+	0xC5, 0x40, 0x0F, 0xC6, 0x01, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x05, 0x40, 0xC5, 0x81, 0xC9, 0x40,
+	0x03, 0x40, 0xD2, 0x80, 0x02, 0x40, 0xD3, 0x80, 0x01, 0x40, 0xD4, 0x40, 0x00, 0x80, 0xC8, 0x40,
+	0x02, 0x40, 0xC7, 0x00, 0x40, 0xC7, 0x40, 0x04, 0x40, 0xC6, 0x41, 0xC7, 0x06, 0xC6, 0x41, 0xC6,
+	0x80, 0x06, 0x80, 0xC5, 0x80, 0x00, 0xC6, 0x80, 0x06, 0x80, 0xC5, 0x80, 0x00, 0xC6, 0x80, 0x06,
+	0x80, 0xC5, 0x80, 0x00, 0x80, 0xC5, 0x80, 0x06, 0x80, 0xC5, 0x80, 0x00, 0x40, 0xC6, 0x06, 0xC6,
+	0x40, 0x01, 0xC6, 0x40, 0x04, 0x40, 0xC6, 0x02, 0x40, 0xC6, 0x40, 0x02, 0x40, 0xC6, 0x80, 0x03,
+	0x80, 0xD1, 0x04, 0x40, 0xD0, 0x40, 0x06, 0xCE, 0x40, 0x08, 0x80, 0xCA, 0x80, 0x0C, 0x40, 0x80,
+	0xC4, 0x80, 0x40, 0x06,
+	// '7'
+	0x40, 0xD4, 0x80, 0x40, 0xD4, 0x80, 0x40, 0xD4, 0x80, 0x40, 0xD4, 0x80, 0x40, 0xD4, 0x80, 0x40,
+	0xD4, 0x0E, 0x80, 0xC5, 0x80, 0x0E, 0xC6, 0x0E, 0x40, 0xC5, 0x80, 0x0E, 0xC6, 0x40, 0x0D, 0x40,
+	0xC5, 0x80, 0x0E, 0xC6, 0x40, 0x0D, 0x40, 0xC6, 0x0E, 0x80, 0xC5, 0x40, 0x0D, 0x40, 0xC6, 0x0E,
+	0x80, 0xC5, 0x40, 0x0D, 0x40, 0xC6, 0x0E, 0x80, 0xC5, 0x80, 0x0E, 0xC6, 0x0E, 0x80, 0xC5, 0x80,
+	0x0E, 0xC6, 0x40, 0x0D, 0x80, 0xC5, 0x80, 0x0E, 0xC6, 0x40, 0x0D, 0x40, 0xC5, 0x80, 0x0E, 0xC6,
+	0x40, 0x0D, 0x40, 0xC6, 0x0E, 0xC6, 0x40, 0x0D, 0x40, 0xC6, 0x0E, 0x80, 0xC5, 0x80, 0x0A,
+	// '8'
+	0x05, 0x40, 0x81, 0xC5, 0x81, 0x40, 0x09, 0x40, 0xCD, 0x40, 0x06, 0x80, 0xCF, 0x80, 0x04, 0x80,
+	0xD1, 0x40, 0x02, 0x40, 0xD3, 0x02, 0x80, 0xC6, 0x80, 0x40, 0x01, 0x40, 0x80, 0xC6, 0x40, 0x01,
+	0x80, 0xC5, 0x80, 0x05, 0xC6, 0x80, 0x01, 0xC6, 0x40, 0x05, 0x80, 0xC5, 0x80, 0x01, 0xC6, 0x40,
+	0x05, 0x40, 0xC5, 0x80, 0x01, 0x80, 0xC5, 0x40, 0x05, 0x80, 0xC5, 0x80, 0x01, 0x40, 0xC5, 0x80,
+	0x05, 0xC6, 0x40, 0x02, 0x80, 0xC5, 0x80, 0x40, 0x01, 0x40, 0x80, 0xC5, 0x80, 0x04, 0xD0, 0x80,
+	0x06, 0x80, 0xCD, 0x40, 0x08, 0x40, 0xCB, 0x40, 0x07, 0x40, 0xCE, 0x80, 0x40, 0x04, 0x80, 0xD1,
+	0x40, 0x02, 0x40, 0xC6, 0x80, 0x02, 0x40, 0x80, 0xC6, 0x40, 0x01, 0xC6, 0x40, 0x05, 0x80, 0xC5,
+	0x80, 0x00, 0x40, 0xC5, 0x80, 0x07, 0xC6, 0x00, 0x40, 0xC5, 0x80, 0x07, 0x80, 0xC5, 0x40, 0x80,
+	0xC5, 0x80, 0x07, 0x80, 0xC5, 0x41, 0xC5, 0x80, 0x07, 0xC6, 0x41, 0xC6, 0x40, 0x05, 0x40, 0xC6,
+	0x01, 0xC7, 0x80, 0x02, 0x40, 0x80, 0xC7, 0x01, 0x80, 0xD3, 0x40, 0x02, 0xD2, 0x80, 0x04, 0xD0,
+	0x80, 0x06, 0x80, 0xCD, 0x40, 0x09, 0x40, 0x81, 0xC5, 0x81, 0x40, 0x05,
+	// '9'
+	0x05, 0x41, 0x80, 0xC3, 0x81, 0x40, 0x0B, 0x40, 0x80, 0xCA, 0x40, 0x08, 0x40, 0xCD, 0x80, 0x06,
+	0x40, 0xCF, 0x80, 0x04, 0x40, 0xD1, 0x80, 0x03, 0x80, 0xC6, 0x40, 0x01, 0x40, 0x80, 0xC6, 0x40,
+	0x01, 0x40, 0xC6, 0x40, 0x04, 0x80, 0xC5, 0x80, 0x01, 0x80, 0xC5, 0x80, 0x06, 0xC6, 0x01, 0x80,
+	0xC5, 0x40, 0x06, 0xC6, 0x40, 0x00, 0xC6, 0x40, 0x06, 0x80, 0xC5, 0x80, 0x00, 0xC6, 0x40, 0x06,
+	0x80, 0xC6, 0x00, 0xC6, 0x40, 0x06, 0xC7, 0x00, 0x80, 0xC5, 0x80, 0x06, 0xC7, 0x00, 0x40, 0xC6,
+	0x40, 0x04, 0x80, 0xC7, 0x40, 0x00, 0xC7, 0x40, 0x01, 0x40, 0x80, 0xC8, 0x40, 0x00, 0x80, 0xD4,
+	0x40, 0x01, 0xD4, 0x03, 0xD3, 0x04, 0x80, 0xC9, 0x40, 0xC6, 0x06, 0x40, 0x80, 0xC3, 0x80, 0x40,
+	0x01, 0xC5, 0x80, 0x0F, 0x40, 0xC5, 0x40, 0x0F, 0x80, 0xC5, 0x0F, 0x40, 0xC5, 0x80, 0x03, 0x80,
+	0x40, 0x08, 0x40, 0xC6, 0x40, 0x03, 0xC2, 0x41, 0x02, 0x41, 0x80, 0xC6, 0x80, 0x04, 0xD1, 0x05,
+	0xD0, 0x06, 0xCE, 0x80, 0x07, 0x40, 0x80, 0xCB, 0x40, 0x0B, 0x40, 0x80, 0xC4, 0x81, 0x40, 0x08,
+	// ':'
+	0x80, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5,
+	0x80, 0x2F, 0x80, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5, 0x81, 0xC5,
+	0x81, 0xC5, 0x80,
+};
+
+static const TFT_GFXglyph_t DejaVuSansBold40Glyphs[] = {
+	{0, 24, 30, 28, 2, -30}, // '0'
+	{161, 21, 29, 28, 4, -29}, // '1'
+	{274, 22, 30, 28, 3, -30}, // '2'
+	{397, 23, 30, 28, 2, -30}, // '3'
+	{530, 25, 29, 28, 1, -29}, // '4'
+	{651, 22, 29, 28, 3, -29}, // '5'
+	{773, 24, 30, 28, 2, -30}, // '6'
+	{937, 23, 29, 28, 2, -29}, // '7'
+	{1032, 24, 30, 28, 2, -30}, // '8'
+	{1204, 24, 30, 28, 2, -30}, // '9'
+	{1364, 8, 22, 16, 4, -22}, // ':'
+};
+
+static const TFT_GFXfont_t DejaVuSansBold40 = {DejaVuSansBold40Bitmaps, DejaVuSansBold40Glyphs, 0x30, 0x3A, 48, nullptr, 0, 2, true};
@@ -0,0 +1,178 @@
+/*!
+	@file     main.cpp
+	@author   Gavin Lyons
+	@brief Example cpp file for ST7789_TFT_PICO library.
+			Proportional and anti-aliased font tests.
+	@note  See USER OPTIONS 0-2 in SETUP function.
+		The font headers in this folder were made from DejaVu Sans
+		(Bitstream Vera license) with extra/tools/font_compiler.py:
+		font_compiler.py DejaVuSans.ttf -o DejaVuSans18.hpp --name DejaVuSans18 --size 18 --bpp 4
+		font_compiler.py DejaVuSans-Bold.ttf -o DejaVuSansBold40.hpp --name DejaVuSansBold40 --size 40 --bpp 2 --chars "0123456789:"
+
+	@test
+		-# Test1300 4 bpp anti-aliased text, draw text and print
+		-# Test1301 Transparent text over a pattern
+		-# Test1302 Clock digits, 2 bpp run length encoded font drawn in a canvas
+*/
+
+// Section ::  libraries
+#include "pico/time.h"
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "st7789/ST7789_TFT.hpp"
+#include "st7789/ST7789_TFT_canvas16.hpp"
+#include "DejaVuSans18.hpp"
+#include "DejaVuSansBold40.hpp"
+
+// Section :: Defines
+//  Test timing related defines
+#define TEST_DELAY1 1000 // mS
+#define TEST_DELAY2 2000 // mS
+#define TEST_DELAY5 5000 // mS
+
+#define CLOCK_WIDTH 220  // Clock canvas width in pixels, "00:00:00" is 200
+#define CLOCK_HEIGHT 50  // Clock canvas height in pixels
+
+// Section :: Globals
+ST7789_TFT myTFT;
+ST7789_TFT_canvas16 clockCanvas;
+uint16_t clockBuffer[CLOCK_WIDTH * CLOCK_HEIGHT]; // 22000 bytes
+
+//  Section ::  Function Headers
+
+void Setup(void); // setup + user options
+void Test1300(void);
+void Test1301(void);
+void Test1302(void);
+void EndTests(void);
+
+//  Section ::  MAIN loop
+
+int main(void)
+{
+	Setup();
+	Test1300();
+	Test1301();
+	Test1302();
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+//  Section ::  Function Space
+
+/*!
+	@brief setup the TFT :: user options 0-2
+*/
+void Setup(void)
+{
+	stdio_init_all(); // optional for error messages , Initialize chosen serial port, default 38400 baud
+	TFT_MILLISEC_DELAY(TEST_DELAY1);
+	printf("TFT :: Start\r\n");
+
+//*************** USER OPTION 0 SPI_SPEED + TYPE ***********
+	bool bhardwareSPI = true; // true for hardware spi, false for software
+
+	if (bhardwareSPI == true) { // hw spi
+		uint32_t TFT_SCLK_FREQ =  8000 ; // Spi freq in KiloHertz , 1000 = 1Mhz
+		myTFT.TFTInitSPIType(TFT_SCLK_FREQ, spi0, true);
+	} else { // sw spi
+		uint16_t SWSPICommDelay = 0; // optional SW SPI GPIO delay in uS
+		myTFT.TFTInitSPIType(SWSPICommDelay);
+	}
+//*********************************************************
+// ******** USER OPTION 1 GPIO *********
+// NOTE if using Hardware SPI clock and data pins will be tied to
+// the chosen interface eg Spi0 CLK=18 DIN=19)
+	int8_t SDIN_TFT = 19;
+	int8_t SCLK_TFT = 18;
+	int8_t DC_TFT = 3;
+	int8_t CS_TFT = 2 ;
+	int8_t RST_TFT = 17;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT, CS_TFT, SCLK_TFT, SDIN_TFT);
+//**********************************************************
+
+// ****** USER OPTION 2 Screen Setup ******
+	uint16_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint16_t OFFSET_ROW = 0; // 3, with screen manufacture tolerance/defects
+	uint16_t TFT_WIDTH = 240;// Screen width in pixels
+	uint16_t TFT_HEIGHT = 280; // Screen height in pixels
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW , TFT_WIDTH , TFT_HEIGHT);
+// ******************************************
+
+	myTFT.TFTST7789Initialize();
+}
+
+/*!
+	@brief Anti-aliased text, blended against bg so bg should be the color behind it.
+		Each run of text on a line goes as one window.
+*/
+void Test1300(void)
+{
+	printf("Test 1300: 4 bpp proportional font\r\n");
+	char teststr1[] = "Proportional font\nanti-aliased, 4 bpp";
+	myTFT.TFTfillScreen(ST7789_BLACK);
+	if (myTFT.TFTsetFontGFX(&DejaVuSans18) != Display_Success)
+		return;
+	myTFT.TFTdrawText(5, 10, teststr1, ST7789_WHITE, ST7789_BLACK);
+	myTFT.TFTfillRect(0, 70, 240, 60, ST7789_NAVY);
+	myTFT.TFTdrawText(5, 80, teststr1, ST7789_YELLOW, ST7789_NAVY);
+
+	myTFT.setTextColor(ST7789_GREEN, ST7789_BLACK);
+	myTFT.TFTsetCursor(5, 150);
+	myTFT.print("print: ");
+	myTFT.print(3.14159);
+	myTFT.TFTsetCursor(5, 180); // wrap is on, it breaks at any character
+	myTFT.print("Wrap on, text longer than the screen goes to the next line");
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+}
+
+/*!
+	@brief Transparent text (bg == color) draws the ink only, anti-aliased
+		fonts then draw coverage of half or more as ink.
+*/
+void Test1301(void)
+{
+	printf("Test 1301: Transparent text\r\n");
+	char teststr1[] = "Transparent text";
+	for (uint16_t i = 0; i < 14; i++)
+		myTFT.TFTfillRect(0, i * 20, 240, 20, (i & 1) ? ST7789_DGREEN : ST7789_BLUE);
+	myTFT.TFTdrawText(10, 60, teststr1, ST7789_WHITE, ST7789_WHITE);
+	myTFT.TFTdrawText(10, 130, teststr1, ST7789_YELLOW, ST7789_YELLOW);
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+}
+
+/*!
+	@brief Clock digits from a font subset to 0-9 and ':'. Composed in a canvas
+		and pushed as one window, so no old digit is left behind when a
+		narrower one is drawn.
+*/
+void Test1302(void)
+{
+	printf("Test 1302: Clock, run length encoded 2 bpp font\r\n");
+	char timeStr[10];
+	myTFT.TFTfillScreen(ST7789_BLACK);
+	clockCanvas.TFTcanvasBegin(clockBuffer, CLOCK_WIDTH, CLOCK_HEIGHT);
+	clockCanvas.TFTsetFontGFX(&DejaVuSansBold40);
+	for (uint16_t second = 0; second < 15; second++)
+	{
+		snprintf(timeStr, sizeof(timeStr), "12:34:%02u", second);
+		myTFT.TFTDMAWait(); // the last push may still be reading the canvas
+		clockCanvas.TFTfillScreen(ST7789_BLACK);
+		clockCanvas.TFTdrawText(10, 2, timeStr, ST7789_CYAN, ST7789_BLACK);
+		clockCanvas.TFTcanvasPush(myTFT, 10, 110);
+		TFT_MILLISEC_DELAY(TEST_DELAY1);
+	}
+	myTFT.TFTFontNum(myTFT.TFTFont_Default); // back to fonts 1-12
+}
+
+/*!
+	@brief  Stop testing and shutdown the TFT
+*/
+void EndTests(void)
+{
+	myTFT.TFTPowerDown();
+	printf("TFT :: Tests Over \n");
+}
+
+// *************** EOF ****************
@@ -0,0 +1,172 @@
+/*!
+	@file     main.cpp
+	@author   Gavin Lyons
+	@brief Example cpp file for ST7789_TFT_PICO library.
+			PIO SPI with DMA, fill and bitmap timing.
+	@note  See USER OPTIONS 0-2 in SETUP function
+
+	@test
+		-# Test1000 Full screen fills, timed
+		-# Test1001 16-bit bitmap, whole and clipped at the right edge (chained DMA rows), timed
+		-# Test1002 CPU work done while a bitmap is sent by DMA
+*/
+
+// Section ::  libraries
+#include "pico/time.h"
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "st7789/ST7789_TFT.hpp"
+
+// Section :: Defines
+//  Test timing related defines
+#define TEST_DELAY1 1000 // mS
+#define TEST_DELAY2 2000 // mS
+#define TEST_DELAY5 5000 // mS
+
+#define BMP_SIZE 120 // Test bitmap width and height in pixels
+
+// Section :: Globals
+ST7789_TFT myTFT;
+uint16_t bitmap[BMP_SIZE * BMP_SIZE]; // 565 test bitmap, filled in Test1001
+
+//  Section ::  Function Headers
+
+void Setup(void); // setup + user options
+void Test1000(void);
+void Test1001(void);
+void Test1002(void);
+void EndTests(void);
+
+//  Section ::  MAIN loop
+
+int main(void)
+{
+	Setup();
+	Test1000();
+	Test1001();
+	Test1002();
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+//  Section ::  Function Space
+
+/*!
+	@brief setup the TFT :: user options 0-2
+*/
+void Setup(void)
+{
+	stdio_init_all(); // optional for error messages , Initialize chosen serial port, default 38400 baud
+	TFT_MILLISEC_DELAY(TEST_DELAY1);
+	printf("TFT :: Start\r\n");
+
+//*************** USER OPTION 0 SPI_SPEED + TYPE ***********
+// PIO SPI, the state machine clocks the data and drives DC.
+// Many panels accept clocks well above the 8 MHz used in the other examples.
+	uint32_t TFT_SCLK_FREQ = 40000; // Spi freq in KiloHertz , 1000 = 1Mhz
+	bool useDMA = true; // feed the PIO FIFO with DMA
+	myTFT.TFTInitSPIType(TFT_SCLK_FREQ, pio0, useDMA);
+//*********************************************************
+// ******** USER OPTION 1 GPIO *********
+// NOTE with PIO SPI any GPIO can be used for clock, data and DC
+	int8_t SDIN_TFT = 19;
+	int8_t SCLK_TFT = 18;
+	int8_t DC_TFT = 3;
+	int8_t CS_TFT = 2 ;
+	int8_t RST_TFT = 17;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT, CS_TFT, SCLK_TFT, SDIN_TFT);
+//**********************************************************
+
+// ****** USER OPTION 2 Screen Setup ******
+	uint16_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint16_t OFFSET_ROW = 0; // 3, with screen manufacture tolerance/defects
+	uint16_t TFT_WIDTH = 240;// Screen width in pixels
+	uint16_t TFT_HEIGHT = 280; // Screen height in pixels
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW , TFT_WIDTH , TFT_HEIGHT);
+// ******************************************
+
+	myTFT.TFTST7789Initialize();
+}
+
+/*!
+	@brief Full screen fills, each one a single window and one DMA color run
+*/
+void Test1000(void)
+{
+	printf("Test 1000: Full screen fills\r\n");
+	const uint16_t colors[] = {ST7789_RED, ST7789_GREEN, ST7789_BLUE, ST7789_BLACK};
+	const uint8_t fills = 40;
+
+	uint32_t start = to_ms_since_boot(get_absolute_time());
+	for (uint8_t i = 0; i < fills; i++)
+		myTFT.TFTfillScreen(colors[i % 4]);
+	myTFT.TFTDMAWait();
+	uint32_t elapsed = to_ms_since_boot(get_absolute_time()) - start;
+	printf("%u fills in %lu mS\r\n", fills, (unsigned long)elapsed);
+
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+	myTFT.TFTsetCursor(5, 5);
+	myTFT.print("Fills/S: ");
+	myTFT.print((fills * 1000UL) / (elapsed ? elapsed : 1));
+	TFT_MILLISEC_DELAY(TEST_DELAY2);
+}
+
+/*!
+	@brief 16-bit bitmap from a native uint16_t array. Drawn whole it goes out
+		as one DMA burst, clipped at the right edge its rows are no longer
+		next to each other in memory and go out as chained DMA rows.
+*/
+void Test1001(void)
+{
+	printf("Test 1001: Bitmap, whole and clipped\r\n");
+	for (uint16_t y = 0; y < BMP_SIZE; y++)
+		for (uint16_t x = 0; x < BMP_SIZE; x++)
+			bitmap[y * BMP_SIZE + x] = ((x >> 2) << 11) | ((y >> 1) << 5) | ((x + y) >> 3);
+
+	myTFT.TFTfillScreen(ST7789_BLACK);
+	uint32_t start = time_us_32();
+	myTFT.TFTdrawBitmap16Buffer(0, 0, bitmap, BMP_SIZE, BMP_SIZE);
+	myTFT.TFTDMAWait();
+	uint32_t whole = time_us_32() - start;
+
+	start = time_us_32();
+	myTFT.TFTdrawBitmap16Buffer(240 - BMP_SIZE / 2, 140, bitmap, BMP_SIZE, BMP_SIZE); // 240 wide screen, half is off the edge
+	myTFT.TFTDMAWait();
+	uint32_t clipped = time_us_32() - start;
+	printf("Whole %lu uS, clipped to half width %lu uS\r\n", (unsigned long)whole, (unsigned long)clipped);
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+}
+
+/*!
+	@brief DMA draw methods return while the data is still being sent, the CPU
+		is free until the next draw call or TFTDMAWait.
+*/
+void Test1002(void)
+{
+	printf("Test 1002: CPU work during DMA\r\n");
+	myTFT.TFTfillScreen(ST7789_BLACK);
+	uint32_t loops = 0;
+	myTFT.TFTdrawBitmap16Buffer(60, 80, bitmap, BMP_SIZE, BMP_SIZE);
+	while (myTFT.TFTDMABusy())
+		loops++; // real work goes here, the bitmap must not be modified
+	myTFT.TFTDMAWait();
+	printf("%lu loops while the bitmap was sent\r\n", (unsigned long)loops);
+
+	myTFT.TFTFontNum(myTFT.TFTFont_Default);
+	myTFT.TFTsetCursor(5, 5);
+	myTFT.print("Loops: ");
+	myTFT.print(loops);
+	TFT_MILLISEC_DELAY(TEST_DELAY5);
+}
+
+/*!
+	@brief  Stop testing and shutdown the TFT
+*/
+void EndTests(void)
+{
+	myTFT.TFTPowerDown();
+	printf("TFT :: Tests Over \n");
+}
+
+// *************** EOF ****************
@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""
+@file     font_compiler.py
+@brief    Host font compiler for the ST7789_TFT_PICO library.
+          Converts a BDF bitmap font, or a TTF/OTF font rasterised at a
+          pixel size, into a proportional font header (TFT_GFXfont_t).
+          Glyph bitmaps are row major, the order the panel is written in,
+          cropped to their inked pixels, optionally subset to the characters
+          in use and run length encoded where that is smaller.
+
+Usage:
+    font_compiler.py myfont.bdf -o MyFont.hpp --name MyFont
+    font_compiler.py myfont.ttf -o Clock.hpp --name Clock --size 32 --bpp 4 --chars "0123456789:."
+
+TTF input needs Pillow (pip install pillow), BDF input needs nothing else.
+"""
+
+import argparse
+import os
+import sys
+
+GLYPH_WIDTH_MAX = 128  # TFT_GFX_GLYPH_WIDTH_MAX in ST7789_TFT_graphics.hpp, TFTsetFontGFX rejects wider glyphs
+
+
+class Glyph:
+    """One character: coverage levels row by row, cropped to the ink."""
+
+    def __init__(self, code, width, height, levels, x_offset, y_offset, x_advance):
+        self.code = code
+        self.width = width
+        self.height = height
+        self.levels = levels          # height rows of width coverage levels
+        self.x_offset = x_offset      # pen to left edge of the bitmap
+        self.y_offset = y_offset      # baseline to top edge, negative above
+        self.x_advance = x_advance
+
+    def crop(self):
+        """Trim rows and columns with no coverage, moving the offsets to match."""
+        rows = [y for y in range(self.height) if any(self.levels[y])]
+        cols = [x for x in range(self.width) if any(row[x] for row in self.levels)]
+        if not rows or not cols:
+            self.width = self.height = 0
+            self.levels = []
+            self.x_offset = self.y_offset = 0
+            return
+        top, bottom, left, right = rows[0], rows[-1], cols[0], cols[-1]
+        self.levels = [row[left:right + 1] for row in self.levels[top:bottom + 1]]
+        self.x_offset += left
+        self.y_offset += top
+        self.width = right - left + 1
+        self.height = bottom - top + 1
+
+
+def load_bdf(path, codes):
+    """Parse a BDF font, returns (glyphs by code, line height)."""
+    glyphs = {}
+    ascent = descent = None
+    box_height = 0
+    with open(path, encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "FONTBOUNDINGBOX":
+            box_height = int(words[2])
+        elif words[0] == "STARTCHAR":
+            code = advance = None
+            bbx = (0, 0, 0, 0)
+            bitmap = []
+            for line in lines:
+                words = line.split()
+                if not words:
+                    continue
+                if words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    advance = int(words[1])
+                elif words[0] == "BBX":
+                    bbx = tuple(int(w) for w in words[1:5])
+                elif words[0] == "BITMAP":
+                    for line in lines:
+                        if line.strip() == "ENDCHAR":
+                            break
+                        bitmap.append(int(line.strip(), 16) if line.strip() else 0)
+                    break
+            if code is None or code not in codes:
+                continue
+            w, h, xoff, yoff = bbx
+            row_bits = ((w + 7) // 8) * 8
+            levels = [[(bitmap[y] >> (row_bits - 1 - x)) & 1 if y < len(bitmap) else 0
+                       for x in range(w)] for y in range(h)]
+            # BBX y offset is the bottom row above the baseline
+            glyphs[code] = Glyph(code, w, h, levels, xoff, -(yoff + h),
+                                 advance if advance is not None else w)
+    if ascent is not None and descent is not None:
+        line_height = ascent + descent
+    else:
+        line_height = box_height
+    return glyphs, line_height
+
+
+def load_ttf(path, size, bpp, threshold, codes, kern):
+    """Rasterise a TTF/OTF font with Pillow, returns (glyphs, line height, kerning pairs)."""
+    try:
+        from PIL import Image, ImageDraw, ImageFont, features
+    except ImportError:
+        sys.exit("font_compiler: TTF input needs Pillow, pip install pillow")
+    # Raqm layout applies GPOS kerning, the basic layout only the kern table
+    layout = ImageFont.Layout.RAQM if features.check("raqm") else ImageFont.Layout.BASIC
+    font = ImageFont.truetype(path, size, layout_engine=layout)
+    ascent, descent = font.getmetrics()
+    level_max = (1 << bpp) - 1
+    pad = size
+    glyphs = {}
+    for code in codes:
+        ch = chr(code)
+        canvas = Image.new("L", (size * 3 + pad * 2, ascent + descent + pad * 2), 0)
+        ImageDraw.Draw(canvas).text((pad, pad + ascent), ch, font=font, fill=255, anchor="ls")
+        w, h = canvas.size
+        pixels = canvas.load()
+        if bpp == 1:
+            levels = [[1 if pixels[x, y] >= threshold else 0 for x in range(w)] for y in range(h)]
+        else:
+            levels = [[(pixels[x, y] * level_max + 127) // 255 for x in range(w)] for y in range(h)]
+        glyphs[code] = Glyph(code, w, h, levels, -pad, -(pad + ascent), round(font.getlength(ch)))
+    pairs = []
+    if kern:
+        for left in codes:
+            for right in codes:
+                a, b = chr(left), chr(right)
+                adjust = round(font.getlength(a + b) - font.getlength(a) - font.getlength(b))
+                if adjust != 0:
+                    pairs.append((left, right, max(-128, min(127, adjust))))
+    return glyphs, ascent + descent, pairs
+
+
+def pack_bits(levels, bpp):
+    """Row major, bpp bits per pixel MSB first, no padding between rows."""
+    out = bytearray()
+    acc = nbits = 0
+    for row in levels:
+        for level in row:
+            acc = (acc << bpp) | level
+            nbits += bpp
+            if nbits == 8:
+                out.append(acc)
+                acc = nbits = 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return bytes(out)
+
+
+def pack_rle(levels, bpp):
+    """One byte per run over all rows: level in the top bpp bits, length - 1 below."""
+    run_max = 1 << (8 - bpp)
+    out = bytearray()
+    stream = [level for row in levels for level in row]
+    i = 0
+    while i < len(stream):
+        level = stream[i]
+        length = 1
+        while i + length < len(stream) and stream[i + length] == level and length < run_max:
+            length += 1
+        out.append((level << (8 - bpp)) | (length - 1))
+        i += length
+    return bytes(out)
+
+
+def parse_codes(args):
+    """Character codes to include, --chars and --chars-file subset the --range."""
+    if args.chars or args.chars_file:
+        text = args.chars or ""
+        if args.chars_file:
+            with open(args.chars_file, encoding="utf-8") as f:
+                text += f.read()
+        codes = sorted({ord(c) for c in text if 0x20 <= ord(c) <= 0xFF})
+    else:
+        first, last = (int(v, 0) for v in args.range.split("-"))
+        codes = list(range(first, last + 1))
+    if not codes:
+        sys.exit("font_compiler: no characters selected")
+    return codes
+
+
+def c_char(code):
+    ch = chr(code)
+    if ch in "\\'" or not ch.isprintable() or code > 0x7E:
+        return "0x%02X" % code
+    return "'%s'" % ch
+
+
+def write_header(path, name, source, glyphs, codes, line_height, pairs, bpp, rle_mode):
+    first, last = codes[0], codes[-1]
+    table = [glyphs.get(code) for code in range(first, last + 1)]
+    packed = [pack_bits(g.levels, bpp) if g else b"" for g in table]
+    runs = [pack_rle(g.levels, bpp) if g else b"" for g in table]
+    packed_size = sum(len(p) for p in packed)
+    rle_size = sum(len(r) for r in runs)
+    rle = rle_mode == "on" or (rle_mode == "auto" and rle_size < packed_size)
+    data = runs if rle else packed
+    if sum(len(d) for d in data) > 0xFFFF:
+        sys.exit("font_compiler: bitmaps over 64 KB, use fewer characters or a smaller size")
+
+    lines = []
+    lines.append("/*!")
+    lines.append("\t@file     %s" % os.path.basename(path))
+    lines.append("\t@brief    %s proportional font for the ST7789_TFT_PICO library," % name)
+    lines.append("\t\t\t  from %s, %u glyphs, %u bpp%s." % (os.path.basename(source), len(glyphs), bpp,
+                                                          ", run length encoded" if rle else ""))
+    lines.append("\t@note     Generated by extra/tools/font_compiler.py, do not edit.")
+    lines.append("*/")
+    lines.append("")
+    lines.append("#pragma once")
+    lines.append("")
+    lines.append('#include "st7789/ST7789_TFT_Font.hpp"')
+    lines.append("")
+    lines.append("static const uint8_t %sBitmaps[] = {" % name)
+    offsets = []
+    offset = 0
+    for code, chunk in zip(range(first, last + 1), data):
+        offsets.append(offset)
+        offset += len(chunk)
+        if chunk:
+            lines.append("\t// %s" % c_char(code))
+            for i in range(0, len(chunk), 16):
+                lines.append("\t" + ", ".join("0x%02X" % b for b in chunk[i:i + 16]) + ",")
+    if offset == 0:
+        lines.append("\t0x00")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const TFT_GFXglyph_t %sGlyphs[] = {" % name)
+    for code, g, off in zip(range(first, last + 1), table, offsets):
+        if g:
+            lines.append("\t{%u, %u, %u, %u, %d, %d}, // %s" % (off, g.width, g.height, g.x_advance,
+                                                            g.x_offset, g.y_offset, c_char(code)))
+        else:
+            lines.append("\t{%u, 0, 0, 0, 0, 0}, // %s not in font" % (off, c_char(code)))
+    lines.append("};")
+    lines.append("")
+    kern_name = "nullptr"
+    if pairs:
+        kern_name = "%sKerns" % name
+        lines.append("static const TFT_GFXkern_t %s[] = {" % kern_name)
+        for left, right, adjust in sorted(pairs):
+            lines.append("\t{%s, %s, %d}," % (c_char(left), c_char(right), adjust))
+        lines.append("};")
+        lines.append("")
+    lines.append("static const TFT_GFXfont_t %s = {%sBitmaps, %sGlyphs, 0x%02X, 0x%02X, %u, %s, %u, %u, %s};"
+                 % (name, name, name, first, last, line_height, kern_name, len(pairs), bpp,
+                    "true" if rle else "false"))
+    lines.append("")
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+    print("%s: %u glyphs, bitmaps %u bytes packed, %u bytes run length, %s used, %u kerning pairs"
+          % (name, len(glyphs), packed_size, rle_size, "run length" if rle else "packed", len(pairs)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile a BDF or TTF font to a ST7789_TFT_PICO proportional font header")
+    parser.add_argument("source", help="BDF, TTF or OTF font file")
+    parser.add_argument("-o", "--output", required=True, help="header file to write")
+    parser.add_argument("--name", required=True, help="C++ name of the font")
+    parser.add_argument("--size", type=int, default=16, help="TTF pixel size, default 16")
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4), default=1, help="bits per pixel, 2 and 4 are anti-aliased, TTF only")
+    parser.add_argument("--threshold", type=int, default=128, help="TTF 1 bpp ink threshold 0-255, default 128")
+    parser.add_argument("--range", default="0x20-0x7E", help="character range, default 0x20-0x7E")
+    parser.add_argument("--chars", help="only these characters, e.g. \"0123456789:.\"")
+    parser.add_argument("--chars-file", help="only the characters in this text file")
+    parser.add_argument("--rle", choices=("auto", "on", "off"), default="auto", help="run length encoding, auto uses it if smaller")
+    parser.add_argument("--no-kern", action="store_true", help="leave out TTF kerning pairs")
+    args = parser.parse_args()
+
+    codes = parse_codes(args)
+    if args.source.lower().endswith(".bdf"):
+        if args.bpp != 1:
+            sys.exit("font_compiler: BDF fonts are 1 bpp")
+        glyphs, line_height = load_bdf(args.source, set(codes))
+        pairs = []
+    else:
+        glyphs, line_height, pairs = load_ttf(args.source, args.size, args.bpp, args.threshold, codes, not args.no_kern)
+    if not glyphs:
+        sys.exit("font_compiler: none of the selected characters are in %s" % args.source)
+    for glyph in glyphs.values():
+        glyph.crop()
+        if (glyph.width > 255 or glyph.height > 255 or not 0 <= glyph.x_advance <= 255 or
+                not -128 <= glyph.x_offset <= 127 or not -128 <= glyph.y_offset <= 127):
+            sys.exit("font_compiler: glyph %s is too large" % c_char(glyph.code))
+        if glyph.width > GLYPH_WIDTH_MAX:
+            sys.exit("font_compiler: glyph %s is %d pixels wide, the library draws up to %d, use a smaller size"
+                     % (c_char(glyph.code), glyph.width, GLYPH_WIDTH_MAX))
+    codes = sorted(glyphs)
+    pairs = [p for p in pairs if p[0] in glyphs and p[1] in glyphs]
+    write_header(args.output, args.name, args.source, glyphs, codes, line_height, pairs, args.bpp, args.rle)
+
+
+if __name__ == "__main__":
+    main()
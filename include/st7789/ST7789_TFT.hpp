@@ -12,6 +12,9 @@
 // Section Libraries
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+#include "hardware/irq.h"
 #include "ST7789_TFT_graphics.hpp"
 
 // Section:  Defines
@@ -37,6 +40,8 @@
 #define ST7789_DISPON   0x29 /**< Display on */
 #define ST7789_IDLE_ON  0x39 /**< Idle Mode ON */
 #define ST7789_IDLE_OFF 0x38 /**< Idle Mode OFF */
+#define ST7789_TEOFF    0x34 /**< Tearing effect line OFF */
+#define ST7789_TEON     0x35 /**< Tearing effect line ON */
 
 // ST7789 Addressing
 #define ST7789_CASET    0x2A /**< Column address set */
@@ -50,11 +55,15 @@
 #define ST7789_COLMOD   0x3A /**< Interface Pixel Format */
 #define ST7789_MADCTL   0x36 /**< Memory Access Control */
 #define ST7789_VSCRSADD 0x37 /**< Vertical Access Control */
+#define ST7789_COLMOD_16BIT 0x55 /**< COLMOD 16-bit RGB565 pixels */
+#define ST7789_COLMOD_12BIT 0x53 /**< COLMOD 12-bit RGB444 pixels, two in three bytes */
 
 // Frame Rate Control
 #define ST7789_FRMCTR1 0xB1 /**< Normal */
 #define ST7789_FRMCTR2 0xB2 /**< idle */
 #define ST7789_FRMCTR3 0xB3 /**< Partial */
+#define ST7789_PORCTRL 0xB2 /**< Porch setting */
+#define ST7789_FRCTRL2 0xC6 /**< Frame rate control in normal mode */
 
 #define ST7789_INVCTR  0xB4 /**< Display Inversion control */
 #define ST7789_DISSET5 0xB6 /**< Display Function set */
@@ -77,6 +86,13 @@
 #define ST7789_MADCTL_BGR 0x08 /**< BGR order */
 #define ST7789_MADCTL_MH  0x04  /**< Horizontal Refresh Order */
 
+#define TFT_ADDR_WINDOW_INVALID 0xFFFFFFFF /**< Address window cache empty, next window sends CASET and RASET */
+#define TFT_VSYNC_TIMEOUT_MS 100 /**< Longest wait for one TE pulse before TFTvsyncWait gives up */
+#define TFT_FRAME_CLOCK_KHZ 10000 /**< ST7789 frame timing oscillator, 10 MHz */
+#define TFT_FRAME_LINES 320		  /**< Lines scanned per frame, the full ST7789 RAM height */
+#define TFT_FRAME_RTNA_MAX 0x1F	  /**< Largest FRCTRL2 RTNA, slowest refresh */
+#define TFT_PORCH_MAX 0x7F		  /**< Largest PORCTRL back or front porch in lines */
+
 // Color definitions 16-Bit Color Values R5G6B5
 #define ST7789_BLACK   0x0000
 #define ST7789_BLUE    0x001F
@@ -159,18 +175,28 @@ public:
 
 	TFT_rotate_e TFT_rotate = TFT_Degrees_0; /**< Enum to hold rotation */
 
+	/*! TFT pixel formats, values are the COLMOD setting */
+	enum TFT_PixelFormat_e : uint8_t
+	{
+		TFT_Pixel_16bit = ST7789_COLMOD_16BIT, /**< RGB565, 2 bytes per pixel */
+		TFT_Pixel_12bit = ST7789_COLMOD_12BIT  /**< RGB444, 3 bytes per 2 pixels */
+	};
+
 	virtual void TFTsetAddrWindow(uint16_t, uint16_t, uint16_t, uint16_t) override;
+	void TFTAddrWindowInvalidate(void);
 
-	void TFTSetupGPIO(int8_t, int8_t, int8_t, int8_t, int8_t);
+	void TFTSetupGPIO(int8_t, int8_t, int8_t, int8_t, int8_t, int8_t te = -1);
 	void TFTInitScreenSize(uint16_t xOffset, uint16_t yOffset, uint16_t w, uint16_t h);
 	void TFTST7789Initialize(void);
-	void TFTInitSPIType(uint32_t baudrate, spi_inst_t *spi);
+	void TFTInitSPIType(uint32_t baudrate, spi_inst_t *spi, bool useDMA = false);
 	void TFTInitSPIType(uint16_t CommDelay);
+	void TFTInitSPIType(uint32_t speed_Khz, PIO pio, bool useDMA = false);
 	void TFTPowerDown(void);
 
 	void TFTsetRotation(TFT_rotate_e r);
 	void TFTchangeInvertMode(bool m);
 	void TFTpartialDisplay(bool m);
+	Display_Return_Codes_e TFTsetPartialArea(uint16_t top, uint16_t bottom);
 	void TFTenableDisplay(bool m);
 	void TFTidleDisplay(bool m);
 	void TFTsleepDisplay(bool m);
@@ -183,14 +209,58 @@ public:
 	void TFTresetSWDisplay(void);
     void TFTsetScrollDefinition(uint16_t th, uint16_t tb, bool sd);
 	void TFTVerticalScroll(uint16_t vsp);
+	Display_Return_Codes_e TFTconsoleBegin(uint16_t top, uint16_t height);
+	void TFTconsoleEnd(void);
+	Display_Return_Codes_e TFTchartBegin(uint16_t left, uint16_t width, int32_t minValue, int32_t maxValue, uint16_t traceColor, uint16_t bgColor);
+	void TFTchartPush(int32_t sample);
+	void TFTchartEnd(void);
+
+	bool TFTvsyncWait(uint8_t frames = 1);
+	Display_Return_Codes_e TFTflushVsync(uint8_t frames = 1);
+	void TFTsetVsyncCallback(void (*pCallback)(void));
+	uint32_t TFTframeCount(void);
+
+	void TFTsetPixelFormat(TFT_PixelFormat_e format);
+	Display_Return_Codes_e TFTsetFrameRate(uint8_t rateHz);
+	Display_Return_Codes_e TFTsetFrameTiming(uint8_t rtna, uint8_t backPorch, uint8_t frontPorch);
+	uint32_t TFTgetFramePeriodUs(void);
 
 private:
 	void TFTHWSPIInitialize(void);
+	void TFTPIOSPIInitialize(void);
 	void TFTResetPIN(void);
 	void cmd89(void);
 	void AdjustWidthHeight(void);
+	void TFTTEInitialize(void);
+	void sendFrameTiming(void);
+	uint16_t scrollAreaDefine(uint16_t start, uint16_t length, bool &reverse);
+	static void TEIRQHandler(void);
 
 	const uint16_t _LibVersionNum = 102; /**< library version number eg 171 1.7.1*/
+	uint32_t _addrWindowCol = TFT_ADDR_WINDOW_INVALID; /**< Last CASET sent, start << 16 | end */
+	uint32_t _addrWindowRow = TFT_ADDR_WINDOW_INVALID; /**< Last RASET sent, start << 16 | end */
+	static ST7789_TFT *_pTEInstance;	/**< Object served by the TE interrupt, one TE pin per program */
+	volatile uint32_t _teFrameCount = 0; /**< TE pulses counted since TFTST7789Initialize */
+	uint32_t _teSyncFrame = 0;			/**< Frame count TFTvsyncWait last returned on */
+	void (*_pTECallback)(void) = nullptr; /**< User function called from the TE interrupt */
+	uint8_t _frameRTNA = 0x0F;	 /**< FRCTRL2 clocks per line setting, 0x0F is about 60Hz */
+	uint8_t _porchBack = 0x0C;	 /**< PORCTRL back porch in lines */
+	uint8_t _porchFront = 0x0C;	 /**< PORCTRL front porch in lines */
+	bool _partialSet = false;	 /**< True once TFTsetPartialArea has set an area */
+	bool _clipRows = false;		 /**< True while drawing is clipped to the partial area rows */
+	uint16_t _clipTop = 0;		 /**< First row of the partial area */
+	uint16_t _clipBottom = 0;	 /**< Last row of the partial area */
+	bool _chartOn = false;		 /**< True while TFTchartPush scrolls a strip chart */
+	uint16_t _chartLeft = 0;	 /**< First screen column of the chart */
+	uint16_t _chartWidth = 0;	 /**< Chart width in columns */
+	uint16_t _chartScroll = 0;	 /**< Chart scroll in columns */
+	uint16_t _chartTFA = 0;		 /**< Frame memory line the chart scroll area starts at */
+	bool _chartReverse = false;	 /**< True if frame memory lines run right to left on screen */
+	int32_t _chartMin = 0;		 /**< Sample value on the bottom row */
+	int32_t _chartMax = 1;		 /**< Sample value on the top row */
+	uint16_t _chartTraceColor = 0xFFFF; /**< Trace color */
+	uint16_t _chartBgColor = 0x0000;	/**< Chart background color */
+	int16_t _chartLastRow = -1;	 /**< Screen row of the last sample, -1 if none yet */
 
 }; // end of class
 
@@ -36,4 +36,47 @@ extern const uint8_t (*pFontMia8x16ptr)[16]; /**< Pointer to Mia font data */
 #endif
 #ifdef _TFT_OPTIONAL_FONT_12
 extern const uint8_t (*pFontDedica6x12ptr)[12]; /**< Pointer to Dedica font data */
-#endif
\ No newline at end of file
+#endif
+
+// Section: Proportional fonts
+
+/*! One glyph of a proportional font, same layout as the Adafruit GFX GFXglyph*/
+struct TFT_GFXglyph_t
+{
+	uint16_t bitmapOffset; /**< Offset of the glyph bitmap in TFT_GFXfont_t::bitmap */
+	uint8_t width;		   /**< Bitmap width in pixels */
+	uint8_t height;		   /**< Bitmap height in pixels */
+	uint8_t xAdvance;	   /**< Distance to move the cursor along the line */
+	int8_t xOffset;		   /**< Cursor to left edge of the bitmap */
+	int8_t yOffset;		   /**< Baseline to top edge of the bitmap, negative above the baseline */
+};
+
+/*! Kerning pair of a proportional font, the table is sorted by left then right*/
+struct TFT_GFXkern_t
+{
+	uint8_t left;  /**< First character of the pair */
+	uint8_t right; /**< Second character of the pair */
+	int8_t adjust; /**< Added to the advance of left when it is followed by right */
+};
+
+/*! Proportional font, the first five members match the Adafruit GFX GFXfont
+	so its font headers can be used as is. Bitmaps are row major, bpp bits per
+	pixel MSB first, packed without padding between rows. At 2 and 4 bpp each
+	pixel is a coverage level, 0 background to 3 or 15 full ink. With rle set
+	each glyph bitmap is a run length stream over its rows instead, one byte
+	per run: level in the top bpp bits, run length - 1 in the rest.*/
+struct TFT_GFXfont_t
+{
+	const uint8_t *bitmap;		   /**< Glyph bitmaps, concatenated */
+	const TFT_GFXglyph_t *glyph;   /**< Glyph table, first to last */
+	uint16_t first;				   /**< First ASCII character */
+	uint16_t last;				   /**< Last ASCII character */
+	uint8_t yAdvance;			   /**< Line height in pixels */
+	const TFT_GFXkern_t *kern = nullptr; /**< Kerning pairs, nullptr if none */
+	uint16_t kernCount = 0;		   /**< Number of kerning pairs */
+	uint8_t bpp = 1;			   /**< Bits per pixel, 1 or anti-aliased 2 or 4 */
+	bool rle = false;			   /**< True if the glyph bitmaps are run length encoded */
+};
+
+typedef TFT_GFXglyph_t GFXglyph; /**< Adafruit GFX name, for its font headers */
+typedef TFT_GFXfont_t GFXfont;	 /**< Adafruit GFX name, for its font headers */
@@ -0,0 +1,45 @@
+/*!
+	@file     ST7789_TFT_canvas16.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for ST7789_TFT_PICO offscreen canvas.
+			  Draws with the graphics methods into a RGB565 RAM buffer
+	@note  See URL for full details.https://github.com/gavinlyonsrepo/ST7789_TFT_PICO
+*/
+
+#pragma once
+
+// Section Libraries
+#include "ST7789_TFT_graphics.hpp"
+
+// Section: Classes
+
+/*!
+	@brief Class for an offscreen RGB565 canvas with the ST7789_TFT_graphics drawing methods.
+	@details Shapes, bitmaps, text and print all draw into the canvas buffer,
+		nothing is sent to the display until TFTcanvasPush.
+*/
+class ST7789_TFT_canvas16 : public ST7789_TFT_graphics
+{
+
+public:
+	ST7789_TFT_canvas16();
+	~ST7789_TFT_canvas16(){};
+
+	virtual void TFTsetAddrWindow(uint16_t, uint16_t, uint16_t, uint16_t) override;
+
+	Display_Return_Codes_e TFTcanvasBegin(uint16_t *pBuffer, uint16_t w, uint16_t h);
+	Display_Return_Codes_e TFTcanvasPush(ST7789_TFT_graphics &display, uint16_t x, uint16_t y);
+	uint16_t *TFTcanvasBuffer(void);
+	uint16_t TFTcanvasWidth(void);
+	uint16_t TFTcanvasHeight(void);
+
+private:
+	// The canvas is always a frame buffer and has no bus, so these are hidden
+	using ST7789_TFT_graphics::TFTsetFrameBuffer;
+	using ST7789_TFT_graphics::TFTsetFrameBufferIndexed;
+	using ST7789_TFT_graphics::TFTflush;
+	using ST7789_TFT_graphics::TFTbandBegin;
+	using ST7789_TFT_graphics::TFTbandNext;
+}; // end of class
+
+// ********************** EOF *********************
@@ -12,7 +12,10 @@
 #include <cstdio>
 #include <cstdlib>
 #include "hardware/spi.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
 #include "ST7789_TFT_Print.hpp"
+#include "ST7789_TFT_Font.hpp"
 
 // Section defines
 
@@ -25,6 +28,50 @@
 		b = t;          \
 	}
 
+/*! Marks a data (parameter) byte in a writeCommandSequence array, unmarked entries are commands*/
+#define TFT_SEQ_DATA 0x0100
+
+/*! Longest span of pixels TFTdrawPixels joins into one window, sets its stack buffer size*/
+#define TFT_PIXEL_SPAN_MAX 64
+
+/*! Pixels packed per buffer in the 12-bit pixel format, two pixels in three bytes*/
+#define TFT_PIXEL12_CHUNK 64
+
+/*! Glyph cache slot table size, the most fonts 1-6 glyphs held at once*/
+#define TFT_GLYPH_CACHE_SLOTS 64
+
+/*! Largest fonts 1-6 glyph in pixels TFTdrawChar rasterises on the stack, size 2 of an 8 wide font*/
+#define TFT_GLYPH_STACK_PIXELS 288
+
+/*! Widest row a bitmap or frame buffer flush builds in one of its two stack row buffers, the 320 pixel ST7789 RAM width, a multiple of 8*/
+#define TFT_ROW_PIXELS_MAX 320
+
+/*! Widest text run window in pixels, sets its two row buffers on the stack, the 320 pixel ST7789 RAM width*/
+#define TFT_TEXT_ROW_PIXELS 320
+
+/*! Most characters a fonts 1-12 text run sends as one window, a row of 4 pixel cells*/
+#define TFT_TEXT_RUN_MAX (TFT_TEXT_ROW_PIXELS / 4)
+
+/*! Most characters a proportional font text run sends as one window*/
+#define TFT_GFX_RUN_MAX 64
+
+/*! Widest proportional font glyph in pixels, sets its coverage level row buffer on the stack*/
+#define TFT_GFX_GLYPH_WIDTH_MAX 128
+
+/*! Most rows one chained DMA transfer sends, sets the size of the row address table*/
+#define TFT_DMA_CHAIN_ROWS 32
+
+/*! Frame buffer dirty tracking tile size, tiles are 1 << TFT_TILE_SHIFT pixels square*/
+#define TFT_TILE_SHIFT 4
+#define TFT_TILE_SIZE (1 << TFT_TILE_SHIFT)          /**< Tile width and height in pixels */
+#define TFT_TILE_ROWS_MAX (320 / TFT_TILE_SIZE)      /**< Tile rows for the 320 pixel ST7789 RAM, one 32 bit mask each */
+
+/*! PIO SPI state machine modes, pixel modes are the autopull width in bits*/
+#define TFT_PIO_MODE_CMD 0       /**< command program, DC in each FIFO word */
+#define TFT_PIO_MODE_PIXEL8 8    /**< pixel program, 8 bit FIFO words */
+#define TFT_PIO_MODE_PIXEL16 16  /**< pixel program, 16 bit FIFO words */
+#define TFT_PIO_MODE_NONE 0xFF   /**< state machine not yet configured */
+
 /*! Enum to define a standard return code for most functions that return failures*/
 enum Display_Return_Codes_e : uint8_t
 {
@@ -79,7 +126,27 @@ public:
 		TFTFont_Dedica = 12		/**< dedica font */
 	};
 
+	/*! One pixel entry for TFTdrawPixels */
+	struct TFT_Pixel_t
+	{
+		int16_t x;		/**< Column co-ord */
+		int16_t y;		/**< Row co-ord */
+		uint16_t color; /**< 565 16-bit color */
+	};
+
+	/*! One horizontal or vertical run entry for TFTdrawRuns */
+	struct TFT_Run_t
+	{
+		int16_t x;		 /**< Start column co-ord */
+		int16_t y;		 /**< Start row co-ord */
+		uint16_t length; /**< Number of pixels in the run */
+		uint16_t color;	 /**< 565 16-bit color */
+		bool vertical;	 /**< true runs down a column, false along a row */
+	};
+
+	using Print::write;
 	virtual size_t write(uint8_t);
+	virtual size_t write(const uint8_t *pBuffer, size_t size);
 	virtual  void TFTsetAddrWindow(uint16_t, uint16_t, uint16_t, uint16_t) = 0 ;
 	void TFTfillScreen(uint16_t color);
 	void TFTsetCursor(int16_t x, int16_t y);
@@ -89,6 +156,8 @@ public:
 	void TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
 	void TFTdrawFastVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color);
 	void TFTdrawFastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color);
+	Display_Return_Codes_e TFTdrawPixels(TFT_Pixel_t *pPixels, uint16_t count);
+	Display_Return_Codes_e TFTdrawRuns(TFT_Run_t *pRuns, uint16_t count);
 
 	void TFTdrawRectWH(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 	Display_Return_Codes_e  TFTfillRectBuffer(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
@@ -113,26 +182,101 @@ public:
 	void setTextColor(uint16_t c);
 	void setTextColor(uint16_t c, uint16_t bg);
 	void setTextSize(uint8_t s);
+	Display_Return_Codes_e TFTsetFontGFX(const TFT_GFXfont_t *pFont);
+	Display_Return_Codes_e TFTsetGlyphCache(uint16_t *pArena, uint32_t arenaSize, uint8_t maxSize = 1);
+	void TFTglyphCacheClear(void);
 
 	// Bitmap & Icon
 	Display_Return_Codes_e  TFTdrawIcon(uint16_t x, uint16_t y, uint16_t w, uint16_t color, uint16_t bgcolor, const unsigned char character[]);
 	Display_Return_Codes_e  TFTdrawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bgcolor, uint8_t *pBmp, uint16_t sizeOfBitmap);
 	Display_Return_Codes_e  TFTdrawBitmap24Data(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h);
 	Display_Return_Codes_e  TFTdrawBitmap16Data(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h);
+	Display_Return_Codes_e  TFTdrawBitmap16Buffer(uint16_t x, uint16_t y, const uint16_t *pBmp, uint16_t w, uint16_t h);
 	Display_Return_Codes_e  TFTdrawSpriteData(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h, uint16_t backgroundColor);
+	Display_Return_Codes_e  TFTdrawBitmap12Data(uint16_t x, uint16_t y, const uint8_t *pBmp, uint16_t w, uint16_t h);
+
+	// 12-bit pixel format
+	uint16_t TFTcolor565to444(uint16_t color);
+	Display_Return_Codes_e TFTconvert565to444(const uint16_t *pSrc, uint8_t *pDst, uint32_t pixels);
+
+	// DMA
+	bool TFTDMABusy(void);
+	void TFTDMAWait(void);
+
+	// Frame buffer
+	Display_Return_Codes_e TFTsetFrameBuffer(uint16_t *pBuffer, uint32_t bufferSize);
+	Display_Return_Codes_e TFTflush(void);
+	void TFTmarkDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+	Display_Return_Codes_e TFTbandBegin(uint16_t *pBuffer, uint32_t bufferSize, uint16_t bgColor = 0x0000);
+	bool TFTbandNext(void);
+	Display_Return_Codes_e TFTsetFrameBufferIndexed(uint8_t *pBuffer, uint32_t bufferSize, uint8_t bitsPerPixel, const uint16_t *pPalette = nullptr, uint16_t paletteSize = 0);
+	void TFTsetPalette(const uint16_t *pPalette, uint16_t paletteSize);
 
 
 protected:
+	/*! Read position in a proportional glyph bitmap, rows are read top to bottom */
+	struct TFT_GFXreader_t
+	{
+		const uint8_t *pData; /**< Glyph bitmap, the next byte for run length encoded fonts */
+		uint8_t row;		  /**< Next row of a run length encoded bitmap */
+		uint8_t level;		  /**< Coverage level of the current run */
+		uint16_t runLeft;	  /**< Pixels left in the current run */
+	};
+
 	void pushColor(uint16_t color);
+	void pushColorRun(uint16_t color, uint32_t count);
+	void pushPixels16(const uint16_t *pixels, uint32_t count);
+	void pushPixelBytes(uint8_t *pData, uint32_t count);
+	void pushPixels12(const uint16_t *pPixels, uint16_t color, uint32_t count);
+	void pixel12Flush(void);
+	uint32_t clipStream(uint32_t &count);
+	void textNewLine(uint8_t lineHeight);
+	void scrollAreaMove(uint16_t topFixed, uint16_t length, uint16_t scroll, bool reverse);
+	uint8_t textLineHeight(void);
+	const uint8_t *fontGlyph(uint8_t character);
+	void glyphRaster(const uint8_t *pColumns, uint16_t color, uint16_t bg, uint8_t size, uint16_t *pOut);
+	void glyphRasterRow(const uint8_t *pColumns, uint16_t color, uint16_t bg, uint8_t size, uint8_t row, uint16_t *pOut);
+	uint16_t textRunMeasure(uint16_t x, uint16_t y, const uint8_t *pText, uint16_t length, uint16_t color, uint16_t bg, uint8_t size, uint16_t right);
+	void textRunDraw(uint16_t x, uint16_t y, const uint8_t *pText, uint16_t count, uint16_t color, uint16_t bg, uint8_t size);
+	const TFT_GFXglyph_t *gfxGlyph(uint8_t character);
+	int8_t gfxKern(uint8_t left, uint8_t right);
+	void gfxReadRow(const TFT_GFXglyph_t *pGlyph, TFT_GFXreader_t &reader, uint8_t row, uint8_t *pLevels);
+	void gfxRasterRow(const TFT_GFXglyph_t *pGlyph, TFT_GFXreader_t &reader, uint8_t row, const uint16_t *pRamp, uint16_t *pOut, int16_t offset, uint16_t width);
+	const uint16_t *gfxRamp(uint16_t color, uint16_t bg);
+	uint16_t gfxRunMeasure(int16_t x, const uint8_t *pText, uint16_t length);
+	int16_t gfxRunDraw(int16_t x, int16_t y, const uint8_t *pText, uint16_t count, uint16_t color, uint16_t bg);
+	Display_Return_Codes_e gfxText(int16_t x, int16_t y, const uint8_t *pText, size_t length, uint16_t color, uint16_t bg);
+	uint16_t *glyphCacheFind(const uint8_t *pColumns, uint8_t character, uint16_t color, uint16_t bg, uint8_t size);
+	void frameBufferSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+	void frameBufferWrite(const uint16_t *pPixels, uint16_t color, uint32_t count);
+	void markDirtyRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+	void flushRect(const uint16_t *pBuffer, const uint8_t *pIndex, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+	bool frameBufferOn(void) const { return _pFrameBuffer != nullptr || _pIndexBuffer != nullptr; } /**< True if drawing goes to a frame buffer */
+	uint8_t paletteIndex(uint16_t color);
+	void indexWrite(uint8_t *pRow, uint16_t x, uint8_t index);
+	void indexExpandRow(const uint8_t *pRow, uint16_t x, uint16_t w, uint16_t *pOut);
 	uint16_t Color565(uint16_t, uint16_t, uint16_t);
 	void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
 	void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color);
+	void drawCircleRuns(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t yy, uint8_t cornername, uint16_t color);
+	void fillRectClip(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	void drawLineRun(int16_t start, int16_t end, int16_t minor, bool steep, uint16_t color);
+	uint8_t lineOutCode(int16_t x, int16_t y);
 
 	void writeCommand(uint8_t);
 	void writeData(uint8_t);
 	void spiWrite(uint8_t);
 	void spiWriteSoftware(uint8_t spidata);
 	void spiWriteDataBuffer(uint8_t *spidata, uint32_t len);
+	void spiWriteDataBufferBegin(uint8_t *spidata, uint32_t len);
+	void spiSetFrameSize(uint8_t bits);
+	void writeCommandSequence(const uint16_t *pSeq, uint8_t len);
+	void dmaStart(const volatile void *pSrc, uint32_t count, dma_channel_transfer_size size, bool incrementRead);
+	void dmaStartRows(uint32_t count, uint16_t rows, dma_channel_transfer_size size);
+	volatile void *dmaTarget(dma_channel_config *pConfig);
+	void pushPixelRows(const void *pFirst, uint16_t w, uint16_t h, uint32_t stride, bool bytes);
+	void pioSetMode(uint8_t mode);
+	void pioWaitIdle(void);
 
 	bool _wrap = true;				/**< wrap text around the screen on overflow*/
 	uint16_t _textcolor = 0xFFFF;	/**< ForeGround color for text*/
@@ -159,11 +303,90 @@ protected:
 	int8_t _TFT_CS;	   /**< GPIO Chip select line */
 	int8_t _TFT_SCLK;  /**< GPIO Clock SPI Line */
 	int8_t _TFT_SDATA; /**< GPIO MOSI data in  SPI Line */
+	int8_t _TFT_TE = -1; /**< GPIO Tearing effect input, -1 if not connected */
 
 	bool _hardwareSPI;			  /**< True for Hardware SPI on , false fpr Software SPI on*/
 	spi_inst_t *_pspiInterface;	  /**< SPI instance pointer*/
-	uint16_t _speedSPIKHz;		  /**< SPI speed value in kilohertz*/
+	uint32_t _speedSPIKHz;		  /**< SPI speed value in kilohertz*/
 	uint16_t _SWSPIGPIODelay = 0; /**< uS GPIO Communications delay, SW SPI ONLY */
+	bool _useDMA = false;		  /**< True if user requested DMA for Hardware SPI */
+	int _dmaChannel = -1;		  /**< Claimed DMA channel for Hardware SPI, -1 if none */
+	bool _dmaActive = false;	  /**< True while a DMA transfer is in flight, CS is held low */
+	int _dmaCtrlChannel = -1;	  /**< Claimed DMA channel that chains rows into _dmaChannel, -1 if none */
+	const void *_dmaRowTable[TFT_DMA_CHAIN_ROWS + 1] = {}; /**< Start of each row of a chained transfer, nullptr ends it */
+	uintptr_t _dmaChainEnd = 0;	  /**< Control channel read address once a chain is done, 0 if none in flight */
+	uint8_t _spiFrameBits = 8;	  /**< Current Hardware SPI frame size, 16 for pixel data 8 otherwise */
+	volatile uint16_t _dmaFillColor = 0; /**< Fixed source word for DMA color fills */
+	bool _pioSPI = false;		  /**< True for PIO SPI on */
+	PIO _pPIO = nullptr;		  /**< PIO block instance pointer, PIO SPI ONLY */
+	int _pioSM = -1;			  /**< Claimed PIO state machine, -1 if none */
+	uint8_t _pioOffsetCmd = 0;	  /**< Instruction memory offset of the command program */
+	uint8_t _pioOffsetPixel = 0;  /**< Instruction memory offset of the pixel program */
+	uint8_t _pioMode = TFT_PIO_MODE_NONE; /**< Current state machine mode */
+	float _pioClockDiv = 1.0f;	  /**< PIO clock divider, SCLK = sys clock / (2 * divider) */
+
+	uint16_t *_pFrameBuffer = nullptr; /**< RGB565 frame or band buffer, nullptr draws straight to the bus */
+	uint16_t _fbWidth = 0;			   /**< Frame buffer width in pixels, also the row stride */
+	uint16_t _fbHeight = 0;			   /**< Frame buffer height in pixels */
+	uint16_t _fbWinX0 = 0;			   /**< Frame buffer window left column */
+	uint16_t _fbWinY0 = 0;			   /**< Frame buffer window top row */
+	uint16_t _fbWinX1 = 0;			   /**< Frame buffer window right column */
+	uint16_t _fbWinY1 = 0;			   /**< Frame buffer window bottom row */
+	uint16_t _fbCursorX = 0;		   /**< Frame buffer write position column */
+	uint16_t _fbCursorY = 0;		   /**< Frame buffer write position row */
+	bool _fbWinValid = false;		   /**< False if the window is off the buffer, writes are dropped */
+	uint32_t _dirtyTiles[TFT_TILE_ROWS_MAX] = {0}; /**< Dirty tile bitmap, one mask per tile row, bit n is tile column n */
+	uint16_t _fbRowOffset = 0;		   /**< First screen row held in the buffer, non zero in band mode */
+	bool _bandMode = false;			   /**< True while drawing a frame band by band */
+	uint16_t *_pBandBuffer[2] = {nullptr, nullptr}; /**< Band buffers, the same pointer twice if not double buffered */
+	uint8_t _bandIndex = 0;			   /**< Band buffer being drawn into */
+	uint16_t _bandRows = 0;			   /**< Rows per band */
+	uint16_t _bandColor = 0x0000;	   /**< Color each band is cleared to */
+	uint8_t *_pIndexBuffer = nullptr;  /**< Indexed color frame buffer, nullptr if not in use */
+	uint8_t _fbBpp = 8;				   /**< Indexed frame buffer bits per pixel, 8 4 or 1 */
+	uint16_t _fbStride = 0;			   /**< Indexed frame buffer row length in bytes */
+	const uint16_t *_pPalette = nullptr; /**< Indexed frame buffer palette, 565 16-bit colors, owned by the caller */
+	uint16_t _paletteSize = 0;		   /**< Number of entries used in _pPalette */
+	uint16_t _paletteCacheColor = 0;   /**< Last color mapped to a palette index */
+	uint8_t _paletteCacheIndex = 0;	   /**< Palette index of _paletteCacheColor */
+	bool _paletteCacheValid = false;   /**< False after the palette changes */
+	bool _pixel12 = false;			   /**< True for the 12-bit RGB444 pixel format, COLMOD 0x53 */
+	bool _pixel12Pending = false;	   /**< A 12-bit pixel is held back waiting for its pair */
+	uint16_t _pixel12Value = 0;		   /**< The held back 444 12-bit pixel */
+	uint32_t _pixel12Left = 0;		   /**< Pixels left in the address window, 0 if unknown */
+	bool _clipStream = false;		   /**< True if the current window is trimmed to the partial area */
+	uint32_t _clipSkip = 0;			   /**< Window pixels still to drop above the partial area */
+	uint32_t _clipSend = 0;			   /**< Window pixels still to send inside the partial area */
+	bool _consoleOn = false;		   /**< True while print scrolls a console with the hardware scroll */
+	uint16_t _consoleTop = 0;		   /**< First screen row of the console */
+	uint16_t _consoleHeight = 0;	   /**< Console height in rows, a whole number of lines */
+	uint8_t _consoleLineHeight = 8;	   /**< Console text line height in rows */
+	uint16_t _consoleLine = 0;		   /**< Console line the cursor is on, 0 is the top line on screen */
+	uint16_t _consoleScroll = 0;	   /**< Console scroll in rows, the screen row of line 0 minus _consoleTop */
+	uint16_t _consoleTFA = 0;		   /**< Frame memory line the scroll area starts at */
+	bool _consoleReverse = false;	   /**< True if frame memory lines run bottom to top on screen */
+
+	/*! One glyph cache slot, the key of the rasterised glyph it holds */
+	struct TFT_GlyphSlot_t
+	{
+		uint32_t lastUse;  /**< _glyphClock value when last drawn, 0 if the slot is empty */
+		uint16_t color;	   /**< Foreground 565 color */
+		uint16_t bg;	   /**< Background 565 color */
+		uint8_t font;	   /**< Font number 1-6 */
+		uint8_t character; /**< ASCII character */
+		uint8_t size;	   /**< Text size */
+	};
+	const TFT_GFXfont_t *_pGFXFont = nullptr; /**< Proportional font in use, nullptr for fonts 1-12 */
+	uint8_t _gfxAscent = 0;			   /**< Rows from the top of a proportional font text line to the baseline */
+	uint16_t _gfxRamp[16];			   /**< Coverage level to 565 color, blended from _gfxRampBg to _gfxRampColor */
+	uint16_t _gfxRampColor = 0;		   /**< Foreground color of _gfxRamp */
+	uint16_t _gfxRampBg = 0;		   /**< Background color of _gfxRamp */
+	uint8_t _gfxRampBpp = 0;		   /**< Bits per pixel _gfxRamp was built for, 0 if not built */
+	uint16_t *_pGlyphArena = nullptr;  /**< Glyph cache RAM, nullptr if the cache is off */
+	uint32_t _glyphSlotPixels = 0;	   /**< Pixels per cache slot, the largest glyph the cache holds */
+	uint8_t _glyphSlotCount = 0;	   /**< Slots in the arena and entries in _pGlyphSlots */
+	uint32_t _glyphClock = 0;		   /**< Counts glyph cache lookups, orders slots for LRU eviction */
+	TFT_GlyphSlot_t *_pGlyphSlots = nullptr; /**< Glyph cache slot table, kept at the end of the arena */
 private:
 	/*! Width of the font in bits each representing a bytes sized column*/
 	enum TFT_Font_width_e : uint8_t
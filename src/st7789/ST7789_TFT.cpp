@@ -8,12 +8,16 @@
 */
 
 #include "../../include/st7789/ST7789_TFT.hpp"
+#include "ST7789_TFT_PIO.pio.h"
+#include <algorithm> // min, max
  
 /*!
 	@brief Constructor for class ST7789_TFT
 */
 ST7789_TFT :: ST7789_TFT(){}
 
+ST7789_TFT *ST7789_TFT::_pTEInstance = nullptr;
+
 /*!
 	@brief : Init Hardware SPI
 */
@@ -30,7 +34,101 @@ void ST7789_TFT::TFTHWSPIInitialize(void)
                     SPI_CPOL_0,      // Polarity (CPOL)
                     SPI_CPHA_0,      // Phase (CPHA)
                     SPI_MSB_FIRST);
+	_spiFrameBits = 8; // 16-bit frames are switched in only for pixel data
+
+	// Claim a DMA channel for buffer writes, fall back to blocking SPI if none free
+	if (_useDMA == true && _dmaChannel < 0)
+	{
+		_dmaChannel = dma_claim_unused_channel(false);
+		if (_dmaChannel < 0)
+			printf("Error TFTHWSPIInitialize 1: No free DMA channel, using blocking SPI\r\n");
+	}
+	// A second channel chains the rows of clipped bitmaps and frame buffer areas
+	if (_dmaChannel >= 0 && _dmaCtrlChannel < 0)
+	{
+		_dmaCtrlChannel = dma_claim_unused_channel(false);
+		if (_dmaCtrlChannel < 0)
+			printf("Error TFTHWSPIInitialize 2: No second DMA channel, rows are sent one by one\r\n");
+	}
+}
+
+/*!
+	@brief : Init PIO SPI
+	@note Claims a state machine on the chosen PIO block and loads the command
+		  and pixel programs, once, a re-initialise keeps them. Falls back to
+		  Software SPI if there is no free state machine or program memory.
+		  CS is held low for the whole PIO session.
+*/
+void ST7789_TFT::TFTPIOSPIInitialize(void)
+{
+	if (_pioSM < 0)
+	{
+		// pio_add_program panics when out of instruction memory, so check
+		// the pixel program still fits once the command program is loaded
+		bool loaded = false;
+		_pioSM = pio_claim_unused_sm(_pPIO, false);
+		if (_pioSM >= 0 && pio_can_add_program(_pPIO, &st7789_tft_cmd_program))
+		{
+			_pioOffsetCmd = pio_add_program(_pPIO, &st7789_tft_cmd_program);
+			if (pio_can_add_program(_pPIO, &st7789_tft_pixel_program))
+			{
+				_pioOffsetPixel = pio_add_program(_pPIO, &st7789_tft_pixel_program);
+				loaded = true;
+			}
+			else
+				pio_remove_program(_pPIO, &st7789_tft_cmd_program, _pioOffsetCmd);
+		}
+		if (loaded == false)
+		{
+			printf("Error TFTPIOSPIInitialize 1: No free PIO state machine or memory, using software SPI\r\n");
+			if (_pioSM >= 0)
+				pio_sm_unclaim(_pPIO, _pioSM);
+			_pioSM = -1;
+			_pioSPI = false;
+			TFT_SCLK_SetDigitalOutput;
+			TFT_SDATA_SetDigitalOutput;
+			TFT_SCLK_SetLow;
+			TFT_SDATA_SetLow;
+			return;
+		}
+	}
+	else
+	{
+		// Re-initialise, keep the state machine and programs already loaded
+		TFTDMAWait();
+		pioWaitIdle();
+	}
+
+	// Hand clock, data and DC to the PIO block
+	pio_gpio_init(_pPIO, _TFT_SCLK);
+	pio_gpio_init(_pPIO, _TFT_SDATA);
+	pio_gpio_init(_pPIO, _TFT_DC);
+	pio_sm_set_consistent_pindirs(_pPIO, _pioSM, _TFT_SCLK, 1, true);
+	pio_sm_set_consistent_pindirs(_pPIO, _pioSM, _TFT_SDATA, 1, true);
+	pio_sm_set_consistent_pindirs(_pPIO, _pioSM, _TFT_DC, 1, true);
+
+	// Two PIO cycles per SCLK period
+	_pioClockDiv = (float)clock_get_hz(clk_sys) / (2.0f * _speedSPIKHz * 1000.0f);
+	if (_pioClockDiv < 1.0f)
+		_pioClockDiv = 1.0f;
+	_pioMode = TFT_PIO_MODE_NONE;
+	pioSetMode(TFT_PIO_MODE_CMD);
+	TFT_CS_SetLow;
 
+	// Claim a DMA channel for pixel writes, fall back to blocking PIO writes if none free
+	if (_useDMA == true && _dmaChannel < 0)
+	{
+		_dmaChannel = dma_claim_unused_channel(false);
+		if (_dmaChannel < 0)
+			printf("Error TFTPIOSPIInitialize 2: No free DMA channel, using blocking PIO SPI\r\n");
+	}
+	// A second channel chains the rows of clipped bitmaps and frame buffer areas
+	if (_dmaChannel >= 0 && _dmaCtrlChannel < 0)
+	{
+		_dmaCtrlChannel = dma_claim_unused_channel(false);
+		if (_dmaCtrlChannel < 0)
+			printf("Error TFTPIOSPIInitialize 3: No second DMA channel, rows are sent one by one\r\n");
+	}
 }
 
 /*!
@@ -40,10 +138,48 @@ void ST7789_TFT::TFTHWSPIInitialize(void)
 void ST7789_TFT ::TFTPowerDown(void)
 {
 	TFTenableDisplay(false);
+	if (_TFT_TE >= 0 && _pTEInstance == this) {
+		gpio_set_irq_enabled(_TFT_TE, GPIO_IRQ_EDGE_RISE, false);
+		gpio_remove_raw_irq_handler(_TFT_TE, &ST7789_TFT::TEIRQHandler);
+		_pTEInstance = nullptr;
+	}
+	if (_pioSPI == true) {
+		TFTDMAWait();
+		pioWaitIdle();
+		pio_sm_set_enabled(_pPIO, _pioSM, false);
+		pio_remove_program(_pPIO, &st7789_tft_pixel_program, _pioOffsetPixel);
+		pio_remove_program(_pPIO, &st7789_tft_cmd_program, _pioOffsetCmd);
+		pio_sm_unclaim(_pPIO, _pioSM);
+		_pioSM = -1;
+		_pioMode = TFT_PIO_MODE_NONE;
+		if (_dmaChannel >= 0) {
+			dma_channel_unclaim(_dmaChannel);
+			_dmaChannel = -1;
+		}
+		if (_dmaCtrlChannel >= 0) {
+			dma_channel_unclaim(_dmaCtrlChannel);
+			_dmaCtrlChannel = -1;
+		}
+		// Return the pins to the CPU so they can be driven low below
+		TFT_SCLK_INIT;
+		TFT_SDATA_INIT;
+		TFT_DC_INIT;
+		TFT_SCLK_SetDigitalOutput;
+		TFT_SDATA_SetDigitalOutput;
+		TFT_DC_SetDigitalOutput;
+	}
 	TFT_DC_SetLow;
 	TFT_RST_SetLow;
 	TFT_CS_SetLow;
 	if (_hardwareSPI == true) {
+		if (_dmaChannel >= 0) {
+			dma_channel_unclaim(_dmaChannel);
+			_dmaChannel = -1;
+		}
+		if (_dmaCtrlChannel >= 0) {
+			dma_channel_unclaim(_dmaCtrlChannel);
+			_dmaCtrlChannel = -1;
+		}
 		spi_deinit(_pspiInterface);
 	}else{
 		TFT_SCLK_SetLow;
@@ -62,6 +198,7 @@ void ST7789_TFT ::TFTResetPIN() {
 	TFT_MILLISEC_DELAY(10);
 	TFT_RST_SetHigh;
 	TFT_MILLISEC_DELAY(10);
+	TFTAddrWindowInvalidate();
 }
 
 /*!
@@ -71,9 +208,12 @@ void ST7789_TFT ::TFTResetPIN() {
 	@param cs chip select GPIO 
 	@param sclk Data clock GPIO  
 	@param din Data to TFT GPIO 
+	@param te Tearing effect output of the TFT, optional, -1 if not connected
+	@note With te connected TFTvsyncWait and TFTflushVsync can time updates to the panel refresh.
 */
-void ST7789_TFT ::TFTSetupGPIO(int8_t rst, int8_t dc, int8_t cs, int8_t sclk, int8_t din)
+void ST7789_TFT ::TFTSetupGPIO(int8_t rst, int8_t dc, int8_t cs, int8_t sclk, int8_t din, int8_t te)
 {
+	_TFT_TE = te;
 	_TFT_SDATA = din;
 	_TFT_SCLK = sclk;
 	_TFT_RST= rst;
@@ -96,7 +236,10 @@ void ST7789_TFT::TFTST7789Initialize() {
 	TFT_DC_SetLow;
 	TFT_CS_SetDigitalOutput;
 	TFT_CS_SetHigh;
-if (_hardwareSPI == false)
+if (_pioSPI == true)
+{
+	TFTPIOSPIInitialize();
+}else if (_hardwareSPI == false)
 {
 	TFT_SCLK_SetDigitalOutput;
 	TFT_SDATA_SetDigitalOutput;
@@ -108,8 +251,106 @@ if (_hardwareSPI == false)
 	cmd89();
 	AdjustWidthHeight();
 	TFTsetRotation(TFT_Degrees_0);
+	if (_TFT_TE >= 0)
+		TFTTEInitialize();
+}
+
+/*!
+	@brief Turn on the TE output and count its pulses in a GPIO interrupt
+	@note TE is set to V-blanking only, the rising edge marks the start of
+		vertical blanking. A raw GPIO handler is used so the program's own
+		GPIO callback is left in place. The handler is added once and
+		removed by TFTPowerDown, a re-initialise keeps it.
+*/
+void ST7789_TFT::TFTTEInitialize(void)
+{
+	writeCommand(ST7789_TEON);
+	writeData(0x00); // V-blanking information only
+	_teFrameCount = 0;
+	_teSyncFrame = 0;
+	if (_pTEInstance == nullptr)
+	{
+		gpio_init(_TFT_TE);
+		gpio_set_dir(_TFT_TE, GPIO_IN);
+		gpio_add_raw_irq_handler(_TFT_TE, &ST7789_TFT::TEIRQHandler);
+	}
+	_pTEInstance = this;
+	gpio_set_irq_enabled(_TFT_TE, GPIO_IRQ_EDGE_RISE, true);
+	irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+/*!
+	@brief TE pin interrupt handler, counts frames and calls the user callback
+*/
+void ST7789_TFT::TEIRQHandler(void)
+{
+	ST7789_TFT *pTFT = _pTEInstance;
+	if (pTFT == nullptr || !(gpio_get_irq_event_mask(pTFT->_TFT_TE) & GPIO_IRQ_EDGE_RISE))
+		return;
+	gpio_acknowledge_irq(pTFT->_TFT_TE, GPIO_IRQ_EDGE_RISE);
+	pTFT->_teFrameCount = pTFT->_teFrameCount + 1;
+	if (pTFT->_pTECallback != nullptr)
+		pTFT->_pTECallback();
+}
+
+/*!
+	@brief Wait for the start of vertical blanking, frames after the last wait
+	@param frames panel frames from the last TFTvsyncWait, 1 for every refresh,
+		2 for every second etc. Sets a locked update rate of refresh rate / frames.
+	@return true on a TE pulse, false if TE is not connected or no pulse arrived
+	@note If drawing took longer than the frames asked for, waits for the next
+		pulse only, so one slow frame does not cause a burst of fast ones.
+		Start large updates straight after the return so the panel scan,
+		which restarts at the top after blanking, stays behind the writes.
+*/
+bool ST7789_TFT::TFTvsyncWait(uint8_t frames)
+{
+	if (_TFT_TE < 0)
+		return false;
+	uint32_t target = _teSyncFrame + frames;
+	if ((int32_t)(_teFrameCount - target) >= 0)
+		target = _teFrameCount + 1; // late, resync on the next pulse
+	uint32_t startMs = to_ms_since_boot(get_absolute_time());
+	while ((int32_t)(_teFrameCount - target) < 0)
+	{
+		if (to_ms_since_boot(get_absolute_time()) - startMs > (uint32_t)TFT_VSYNC_TIMEOUT_MS * frames)
+		{
+			printf("Error TFTvsyncWait 1: No TE pulse from the TFT\r\n");
+			return false;
+		}
+		tight_loop_contents();
+	}
+	_teSyncFrame = target;
+	return true;
 }
 
+/*!
+	@brief Flush the frame buffer at the start of vertical blanking
+	@param frames panel frames from the last TFTvsyncWait, see TFTvsyncWait
+	@return as TFTflush
+	@note Any DMA transfer from the last flush is finished before the wait,
+		so the new flush starts on the TE edge. If TE is not connected this
+		is the same as TFTflush.
+*/
+Display_Return_Codes_e ST7789_TFT::TFTflushVsync(uint8_t frames)
+{
+	TFTDMAWait();
+	TFTvsyncWait(frames);
+	return TFTflush();
+}
+
+/*!
+	@brief Set a function to be called on every TE pulse
+	@param pCallback function called in interrupt context, keep it short, nullptr to remove
+*/
+void ST7789_TFT::TFTsetVsyncCallback(void (*pCallback)(void)) { _pTECallback = pCallback; }
+
+/*!
+	@brief Get the number of TE pulses since TFTST7789Initialize
+	@return panel frame count, 0 if TE is not connected
+*/
+uint32_t ST7789_TFT::TFTframeCount(void) { return _teFrameCount; }
+
 
 /*!
 	@brief Toggle the invert mode
@@ -126,6 +367,8 @@ void ST7789_TFT ::TFTchangeInvertMode(bool invert) {
 /*!
 	@brief Toggle the partial display mode
 	@param partialDisplay true  on false  off
+	@note With an area set by TFTsetPartialArea, drawing is restricted to the
+		area while partial mode is on and drawn everywhere again when off.
 */
 void ST7789_TFT ::TFTpartialDisplay(bool partialDisplay){
 	if(partialDisplay) {
@@ -133,6 +376,58 @@ void ST7789_TFT ::TFTpartialDisplay(bool partialDisplay){
 	} else {
 		writeCommand(ST7789_NORON);
 	}
+	_clipRows = partialDisplay && _partialSet;
+	TFTAddrWindowInvalidate();
+}
+
+/*!
+	@brief Set the partial display area and turn partial mode on
+	@param top first row of the area
+	@param bottom last row of the area
+	@return
+		-# Display_Success=success
+		-# Display_ShapeScreenBounds=rows out of order or off screen
+		-# Display_GenericError=rotation is 90 or 270 degrees
+	@note Only the rows of the area are scanned, the rest of the panel is
+		not refreshed, which saves power. All drawing is clipped to the area
+		at the address window, so nothing outside is sent over SPI.
+		TFTpartialDisplay(false) returns to normal mode. The area is a band of
+		panel rows, so it can only be set at 0 or 180 degrees rotation, and
+		TFTsetRotation ends partial mode.
+*/
+Display_Return_Codes_e ST7789_TFT::TFTsetPartialArea(uint16_t top, uint16_t bottom)
+{
+	if (TFT_rotate == TFT_Degrees_90 || TFT_rotate == TFT_Degrees_270)
+	{
+		printf("Error TFTsetPartialArea 1: Rotation must be 0 or 180 degrees\r\n");
+		return Display_GenericError;
+	}
+	if (top > bottom || bottom >= _heightTFT)
+	{
+		printf("Error TFTsetPartialArea 2: Rows %u to %u out of screen bounds\r\n", top, bottom);
+		return Display_ShapeScreenBounds;
+	}
+	// PTLAR counts frame memory lines, MY (0 degrees) mirrors rows top to bottom
+	uint16_t start = top + _YStart;
+	uint16_t end = bottom + _YStart;
+	if (TFT_rotate == TFT_Degrees_0)
+	{
+		start = 319 - (bottom + _YStart);
+		end = 319 - (top + _YStart);
+	}
+	const uint16_t seqPartial[] = {
+		ST7789_PTLAR,
+		uint16_t(TFT_SEQ_DATA | (start >> 8)), uint16_t(TFT_SEQ_DATA | (start & 0xFF)),
+		uint16_t(TFT_SEQ_DATA | (end >> 8)), uint16_t(TFT_SEQ_DATA | (end & 0xFF)),
+		ST7789_PTLON
+	};
+	writeCommandSequence(seqPartial, sizeof(seqPartial) / sizeof(seqPartial[0]));
+	_clipTop = top;
+	_clipBottom = bottom;
+	_partialSet = true;
+	_clipRows = true;
+	TFTAddrWindowInvalidate();
+	return Display_Success;
 }
 
 /*!
@@ -177,7 +472,12 @@ void ST7789_TFT ::TFTidleDisplay(bool idleMode){
 	@brief return Display to normal mode
 	@note used after scroll set for example
 */
-void ST7789_TFT::TFTNormalMode(void){writeCommand(ST7789_NORON);}
+void ST7789_TFT::TFTNormalMode(void)
+{
+	writeCommand(ST7789_NORON);
+	_clipRows = false; // partial mode is off, draw everywhere again
+	TFTAddrWindowInvalidate();
+}
 
 
 /*!
@@ -187,6 +487,8 @@ void ST7789_TFT::TFTNormalMode(void){writeCommand(ST7789_NORON);}
 	1=  90 rotate
 	2 = 180 rotate
 	3 =  270 rotate
+	@note Ends partial mode, the partial area rows are tied to the old
+		rotation, set it again with TFTsetPartialArea.
 */
 void ST7789_TFT ::TFTsetRotation(TFT_rotate_e mode) {
 	uint8_t madctl = 0;
@@ -222,8 +524,16 @@ void ST7789_TFT ::TFTsetRotation(TFT_rotate_e mode) {
 			_heightTFT = _widthStartTFT;
 			break;
 	}
+	TFT_rotate = (TFT_rotate_e)rotation;
+	if (_partialSet == true)
+	{
+		writeCommand(ST7789_NORON);
+		_partialSet = false;
+		_clipRows = false;
+	}
 	writeCommand(ST7789_MADCTL);
 	writeData(madctl);
+	TFTAddrWindowInvalidate(); // offsets and axes have changed
 }
 
 /*!
@@ -252,13 +562,33 @@ void ST7789_TFT  :: TFTInitScreenSize(uint16_t colOffset, uint16_t rowOffset, ui
 	@brief intialise HW SPI setup
 	@param speed_Khz SPI baudrate in Khz , 1000 = 1 Mhz
 	@param spi_interface Spi interface, spi0 spi1 etc
+	@param useDMA true to send pixel buffers with DMA, default false
 	@note method overload used , method 1 hardware SPI 
 */
-void ST7789_TFT  :: TFTInitSPIType(uint32_t speed_Khz,  spi_inst_t* spi_interface) 
+void ST7789_TFT  :: TFTInitSPIType(uint32_t speed_Khz,  spi_inst_t* spi_interface, bool useDMA) 
 {
 	 _pspiInterface = spi_interface;
 	_speedSPIKHz = speed_Khz;
 	_hardwareSPI = true;
+	_pioSPI = false;
+	_useDMA = useDMA;
+}
+
+/*!
+	@brief intialise PIO SPI setup
+	@param speed_Khz SPI baudrate in Khz , 1000 = 1 Mhz
+	@param pio PIO block, pio0 or pio1
+	@param useDMA true to feed pixel data to the PIO with DMA, default false
+	@note method overload used , method 3 PIO SPI.
+		Any GPIO can be used for SCLK, SDATA and DC. CS is held low by the CPU.
+*/
+void ST7789_TFT::TFTInitSPIType(uint32_t speed_Khz, PIO pio, bool useDMA)
+{
+	_pPIO = pio;
+	_speedSPIKHz = speed_Khz;
+	_hardwareSPI = false;
+	_pioSPI = true;
+	_useDMA = useDMA;
 }
 
 /*!
@@ -270,6 +600,7 @@ void ST7789_TFT ::TFTInitSPIType(uint16_t CommDelay)
 {
 	TFTSwSpiGpioDelaySet(CommDelay);
 	_hardwareSPI = false;
+	_pioSPI = false;
 }
 
 /*!
@@ -304,8 +635,9 @@ void ST7789_TFT::cmd89(void)
 	writeCommand(ST7789_SLPOUT);
 	TFT_MILLISEC_DELAY (500);
 	writeCommand(ST7789_COLMOD); //Set color mode
-	writeData(0x55); // 16 bit color
+	writeData(_pixel12 ? ST7789_COLMOD_12BIT : ST7789_COLMOD_16BIT); // 16 or 12 bit color
 	TFT_MILLISEC_DELAY (10);
+	sendFrameTiming(); // porches and refresh rate
 
 	writeCommand(ST7789_MADCTL); // Mem access ctrl (directions)
 	writeData(0x08); // Row/col address, top-bottom refresh
@@ -314,6 +646,7 @@ void ST7789_TFT::cmd89(void)
 	spiWriteDataBuffer(CASETsequence, sizeof(CASETsequence));
 	writeCommand(ST7789_RASET);  //Row address set
 	spiWriteDataBuffer(RASETsequence, sizeof(RASETsequence));
+	TFTAddrWindowInvalidate();
 
 	writeCommand(ST7789_INVON);
 	TFT_MILLISEC_DELAY (10);
@@ -352,24 +685,77 @@ void ST7789_TFT::AdjustWidthHeight() {
   @param  x1  Width of window
   @param  y1  Height of window
   @note https://en.wikipedia.org/wiki/Bit_blit
+	The last column and row windows sent are cached, CASET and RASET are
+	skipped when unchanged. See TFTAddrWindowInvalidate.
+	In frame buffer mode the window is set in RAM instead.
  */
 void ST7789_TFT::TFTsetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-	uint8_t x0Higher = (x0 >> 8) + _XStart;
-	uint8_t x0Lower  = (x0 &  0xFF) + _XStart;
-	uint8_t y0Higher = (y0 >> 8) + _YStart;
-	uint8_t y0Lower  = (y0 &  0xFF) + _YStart;
-	uint8_t x1Higher = (x1 >> 8) + _XStart;
-	uint8_t x1Lower  = (x1 &  0xFF) + _XStart;
-	uint8_t y1Higher = (y1 >> 8) + _YStart;
-	uint8_t y1Lower  = (y1 &  0xFF) + _YStart;
-	uint8_t seqCASET[]    {x0Higher ,x0Lower,x1Higher,x1Lower};
-	uint8_t seqRASET[]    {y0Higher,y0Lower,y1Higher,y1Lower};
-	writeCommand(ST7789_CASET); //Column address set
-	spiWriteDataBuffer(seqCASET, sizeof(seqCASET));
-	writeCommand(ST7789_RASET); //Row address set
-	spiWriteDataBuffer(seqRASET, sizeof(seqRASET));
-	writeCommand(ST7789_RAMWR); // Write to RAM*/
+	if (frameBufferOn())
+	{
+		frameBufferSetWindow(x0, y0, x1, y1); // draw into RAM, sent by TFTflush
+		return;
+	}
+	_clipStream = false;
+	if (_clipRows == true && (y0 < _clipTop || y1 > _clipBottom))
+	{
+		// Partial area, trim the window to its rows and drop the pixels of the others
+		_clipStream = true;
+		if (y1 < _clipTop || y0 > _clipBottom)
+		{
+			_clipSkip = _clipSend = 0;
+			return;
+		}
+		uint32_t w = x1 - x0 + 1;
+		uint16_t top = (y0 < _clipTop) ? _clipTop : y0;
+		uint16_t bottom = (y1 > _clipBottom) ? _clipBottom : y1;
+		_clipSkip = (top - y0) * w;
+		_clipSend = (bottom - top + 1) * w;
+		y0 = top;
+		y1 = bottom;
+	}
+	// Panel RAM coordinates, offsets added with 16-bit math
+	uint16_t col0 = x0 + _XStart;
+	uint16_t col1 = x1 + _XStart;
+	uint16_t row0 = y0 + _YStart;
+	uint16_t row1 = y1 + _YStart;
+	uint32_t colWindow = ((uint32_t)col0 << 16) | col1;
+	uint32_t rowWindow = ((uint32_t)row0 << 16) | row1;
+	uint16_t seqWindow[11];
+	uint8_t len = 0;
+	// Only send the axes that changed, RAMWR always resets the write pointer to the window start
+	if (colWindow != _addrWindowCol)
+	{
+		seqWindow[len++] = ST7789_CASET; //Column address set
+		seqWindow[len++] = TFT_SEQ_DATA | (col0 >> 8);
+		seqWindow[len++] = TFT_SEQ_DATA | (col0 & 0xFF);
+		seqWindow[len++] = TFT_SEQ_DATA | (col1 >> 8);
+		seqWindow[len++] = TFT_SEQ_DATA | (col1 & 0xFF);
+		_addrWindowCol = colWindow;
+	}
+	if (rowWindow != _addrWindowRow)
+	{
+		seqWindow[len++] = ST7789_RASET; //Row address set
+		seqWindow[len++] = TFT_SEQ_DATA | (row0 >> 8);
+		seqWindow[len++] = TFT_SEQ_DATA | (row0 & 0xFF);
+		seqWindow[len++] = TFT_SEQ_DATA | (row1 >> 8);
+		seqWindow[len++] = TFT_SEQ_DATA | (row1 & 0xFF);
+		_addrWindowRow = rowWindow;
+	}
+	seqWindow[len++] = ST7789_RAMWR; // Write to RAM
+	writeCommandSequence(seqWindow, len);
+	_pixel12Left = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+/*!
+	@brief Forget the cached address window so the next TFTsetAddrWindow sends CASET and RASET
+	@note Called on reset, init, rotation and scroll changes. Call after writing
+		CASET or RASET directly with writeCommand.
+*/
+void ST7789_TFT::TFTAddrWindowInvalidate(void)
+{
+	_addrWindowCol = TFT_ADDR_WINDOW_INVALID;
+	_addrWindowRow = TFT_ADDR_WINDOW_INVALID;
 }
 
 /*!
@@ -395,6 +781,7 @@ void ST7789_TFT::TFTsetScrollDefinition(uint16_t top_fix_heightTFT, uint16_t bot
 	} else {
 		writeData(ST7789_SRLTTB); //top to bottom
 	}
+	TFTAddrWindowInvalidate();
 }
 
 /*!
@@ -404,6 +791,279 @@ void ST7789_TFT ::TFTVerticalScroll(uint16_t _vsp) {
 	writeCommand(ST7789_VSCRSADD);
 	writeData(_vsp >> 8);
 	writeData(_vsp & 0xFF);
+	TFTAddrWindowInvalidate();
+}
+
+/*!
+	@brief Set the panel refresh rate, keeping the porch settings
+	@param rateHz wanted refresh rate in Hz, about 39 to 116 with the default porches
+	@return
+		-# Display_Success=success
+		-# Display_GenericError=rate is zero
+	@note The nearest rate the ST7789 can make is used, rates out of range are
+		clamped, read the result with TFTgetFramePeriodUs. Lower rates save
+		power on static screens. Kept and resent by TFTST7789Initialize.
+*/
+Display_Return_Codes_e ST7789_TFT::TFTsetFrameRate(uint8_t rateHz)
+{
+	if (rateHz == 0)
+	{
+		printf("Error TFTsetFrameRate 1: Frame rate must be above zero\r\n");
+		return Display_GenericError;
+	}
+	// Frame rate = 10MHz / ((320 + back porch + front porch) * (250 + RTNA * 16))
+	uint32_t lines = TFT_FRAME_LINES + _porchBack + _porchFront;
+	uint32_t clocksPerLine = (TFT_FRAME_CLOCK_KHZ * 1000UL + (rateHz * lines) / 2) / (rateHz * lines);
+	int32_t rtna = ((int32_t)clocksPerLine - 250 + 8) / 16;
+	if (rtna < 0)
+		rtna = 0;
+	if (rtna > TFT_FRAME_RTNA_MAX)
+		rtna = TFT_FRAME_RTNA_MAX;
+	return TFTsetFrameTiming(rtna, _porchBack, _porchFront);
+}
+
+/*!
+	@brief Set the panel frame timing registers directly
+	@param rtna FRCTRL2 line period, 250 + rtna * 16 oscillator clocks, 0-31
+	@param backPorch PORCTRL back porch in lines, 1-127
+	@param frontPorch PORCTRL front porch in lines, 1-127
+	@return
+		-# Display_Success=success
+		-# Display_GenericError=a setting is out of range
+	@note Longer porches give more vertical blanking time for TE synced updates,
+		at a lower refresh rate. Kept and resent by TFTST7789Initialize.
+*/
+Display_Return_Codes_e ST7789_TFT::TFTsetFrameTiming(uint8_t rtna, uint8_t backPorch, uint8_t frontPorch)
+{
+	if (rtna > TFT_FRAME_RTNA_MAX || backPorch == 0 || backPorch > TFT_PORCH_MAX || frontPorch == 0 || frontPorch > TFT_PORCH_MAX)
+	{
+		printf("Error TFTsetFrameTiming 1: RTNA %u or porches %u %u out of range\r\n", rtna, backPorch, frontPorch);
+		return Display_GenericError;
+	}
+	_frameRTNA = rtna;
+	_porchBack = backPorch;
+	_porchFront = frontPorch;
+	sendFrameTiming();
+	return Display_Success;
+}
+
+/*!
+	@brief Get the panel refresh period from the frame timing settings
+	@return frame period in microseconds, e.g. 16856 (59.3Hz) at the defaults
+	@note Nominal value, the ST7789 oscillator may differ by a few percent.
+		TFTvsyncWait measures the real refresh if the TE pin is connected.
+*/
+uint32_t ST7789_TFT::TFTgetFramePeriodUs(void)
+{
+	uint32_t lines = TFT_FRAME_LINES + _porchBack + _porchFront;
+	uint32_t clocksPerLine = 250 + (uint32_t)_frameRTNA * 16;
+	return (lines * clocksPerLine * 1000UL) / TFT_FRAME_CLOCK_KHZ;
+}
+
+/*!
+	@brief Send the porch and frame rate settings to the TFT
+	@note Idle and partial mode porches are left at their defaults.
+*/
+void ST7789_TFT::sendFrameTiming(void)
+{
+	const uint16_t seqTiming[] = {
+		ST7789_PORCTRL,
+		uint16_t(TFT_SEQ_DATA | _porchBack), uint16_t(TFT_SEQ_DATA | _porchFront),
+		TFT_SEQ_DATA | 0x00, // separate idle and partial porches off
+		TFT_SEQ_DATA | 0x33, TFT_SEQ_DATA | 0x33,
+		ST7789_FRCTRL2,
+		uint16_t(TFT_SEQ_DATA | _frameRTNA) // dot inversion
+	};
+	writeCommandSequence(seqTiming, sizeof(seqTiming) / sizeof(seqTiming[0]));
+}
+
+/*!
+	@brief Select the 16-bit RGB565 or 12-bit RGB444 pixel format
+	@param format TFT_Pixel_16bit or TFT_Pixel_12bit
+	@note 12-bit sends 25% fewer bytes per pixel, drawing methods still take
+		565 colors and convert them. Kept and resent by TFTST7789Initialize.
+		Stored 565 images can be converted once with TFTconvert565to444 and
+		drawn with TFTdrawBitmap12Data.
+*/
+void ST7789_TFT::TFTsetPixelFormat(TFT_PixelFormat_e format)
+{
+	writeCommand(ST7789_COLMOD); // finishes any held back 12-bit pixel first
+	writeData(format);
+	_pixel12 = (format == TFT_Pixel_12bit);
+	TFTAddrWindowInvalidate();
+}
+
+/*!
+	@brief Start a scrolling text console, print then scrolls with the hardware scroll
+	@param top first screen row of the console
+	@param height console height in rows, rounded down to whole text lines
+	@return
+		-# Display_Success=success
+		-# Display_ShapeScreenBounds=console off screen or under one text line high
+		-# Display_GenericError=rotation 90 or 270 degrees, or frame buffer mode on
+	@note Set the font and text size first, they must not change while the
+		console is on. On a new line at the bottom only that one line is
+		cleared and the rest is moved by the scroll start address, so each line
+		costs one line of pixels. Rows above and below the console stay fixed.
+		Scrolling runs along the panel rows, so rotation must be 0 or 180 degrees.
+*/
+Display_Return_Codes_e ST7789_TFT::TFTconsoleBegin(uint16_t top, uint16_t height)
+{
+	if (TFT_rotate == TFT_Degrees_90 || TFT_rotate == TFT_Degrees_270 || frameBufferOn())
+	{
+		printf("Error TFTconsoleBegin 1: Needs rotation 0 or 180 and frame buffer mode off\r\n");
+		return Display_GenericError;
+	}
+	uint8_t lineHeight = textLineHeight();
+	if (top >= _heightTFT || height > _heightTFT - top || height < lineHeight)
+	{
+		printf("Error TFTconsoleBegin 2: Console rows %u + %u out of screen bounds\r\n", top, height);
+		return Display_ShapeScreenBounds;
+	}
+	height -= height % lineHeight;
+	_chartOn = false;
+	_consoleTFA = scrollAreaDefine(top, height, _consoleReverse);
+	_consoleTop = top;
+	_consoleHeight = height;
+	_consoleLineHeight = lineHeight;
+	_consoleLine = 0;
+	_consoleScroll = 0;
+	_consoleOn = true;
+	fillRectClip(0, top, _widthTFT, height, _textbgcolor);
+	TFTsetCursor(0, top);
+	return Display_Success;
+}
+
+/*!
+	@brief Set the hardware scroll area from screen co-ordinates, with no scroll
+	@param start first screen row at 0 or 180 degrees, or column at 90 or 270 degrees
+	@param length area size in rows or columns
+	@param reverse set true if frame memory lines run the opposite way to the screen co-ordinate
+	@return frame memory line the scroll area starts at
+	@note Scrolling runs along the panel rows, which are screen columns at 90
+		and 270 degrees. MY (0 and 90 degrees) mirrors the frame memory lines.
+*/
+uint16_t ST7789_TFT::scrollAreaDefine(uint16_t start, uint16_t length, bool &reverse)
+{
+	bool sideways = (TFT_rotate == TFT_Degrees_90 || TFT_rotate == TFT_Degrees_270);
+	uint16_t offset = sideways ? _XStart : _YStart;
+	reverse = (TFT_rotate == TFT_Degrees_0 || TFT_rotate == TFT_Degrees_90);
+	uint16_t topFixed = reverse ? 320 - (start + offset + length) : start + offset;
+	uint16_t bottomFixed = 320 - topFixed - length;
+	const uint16_t seqScroll[] = {
+		ST7789_VSCRDEF,
+		uint16_t(TFT_SEQ_DATA | (topFixed >> 8)), uint16_t(TFT_SEQ_DATA | (topFixed & 0xFF)),
+		uint16_t(TFT_SEQ_DATA | (length >> 8)), uint16_t(TFT_SEQ_DATA | (length & 0xFF)),
+		uint16_t(TFT_SEQ_DATA | (bottomFixed >> 8)), uint16_t(TFT_SEQ_DATA | (bottomFixed & 0xFF)),
+		ST7789_VSCRSADD,
+		uint16_t(TFT_SEQ_DATA | (topFixed >> 8)), uint16_t(TFT_SEQ_DATA | (topFixed & 0xFF))
+	};
+	writeCommandSequence(seqScroll, sizeof(seqScroll) / sizeof(seqScroll[0]));
+	return topFixed;
+}
+
+/*!
+	@brief Start a scrolling strip chart, samples enter on the right and move left
+	@param left first screen column of the chart
+	@param width chart width in columns
+	@param minValue sample value drawn on the bottom row
+	@param maxValue sample value drawn on the top row
+	@param traceColor 565 16-bit color of the trace
+	@param bgColor 565 16-bit chart background color
+	@return
+		-# Display_Success=success
+		-# Display_ShapeScreenBounds=chart off screen or under two columns wide
+		-# Display_GenericError=rotation 0 or 180 degrees, frame buffer mode on, or minValue not below maxValue
+	@note Each TFTchartPush moves the chart one column with the hardware scroll
+		and draws only the new column, so a sample costs one column of pixels.
+		The hardware scroll runs along panel rows, which are screen columns at
+		90 and 270 degrees only. The whole height of the chart columns scrolls.
+*/
+Display_Return_Codes_e ST7789_TFT::TFTchartBegin(uint16_t left, uint16_t width, int32_t minValue, int32_t maxValue, uint16_t traceColor, uint16_t bgColor)
+{
+	if (TFT_rotate == TFT_Degrees_0 || TFT_rotate == TFT_Degrees_180 || frameBufferOn() || minValue >= maxValue)
+	{
+		printf("Error TFTchartBegin 1: Needs rotation 90 or 270, frame buffer mode off and min below max\r\n");
+		return Display_GenericError;
+	}
+	if (left >= _widthTFT || width > _widthTFT - left || width < 2)
+	{
+		printf("Error TFTchartBegin 2: Chart columns %u + %u out of screen bounds\r\n", left, width);
+		return Display_ShapeScreenBounds;
+	}
+	_consoleOn = false;
+	_chartTFA = scrollAreaDefine(left, width, _chartReverse);
+	_chartLeft = left;
+	_chartWidth = width;
+	_chartScroll = 0;
+	_chartMin = minValue;
+	_chartMax = maxValue;
+	_chartTraceColor = traceColor;
+	_chartBgColor = bgColor;
+	_chartLastRow = -1;
+	_chartOn = true;
+	fillRectClip(left, 0, width, _heightTFT, bgColor);
+	return Display_Success;
+}
+
+/*!
+	@brief Add a sample to the strip chart
+	@param sample value, clamped to the chart range
+	@note The new column is sent as one 1 pixel wide window holding a
+		background run, a trace run joining it to the last sample and a
+		second background run.
+*/
+void ST7789_TFT::TFTchartPush(int32_t sample)
+{
+	if (_chartOn == false)
+		return;
+	if (sample < _chartMin)
+		sample = _chartMin;
+	if (sample > _chartMax)
+		sample = _chartMax;
+	int16_t row = (_heightTFT - 1) - (int16_t)(((int64_t)(sample - _chartMin) * (_heightTFT - 1)) / (_chartMax - _chartMin));
+	int16_t traceTop = row, traceBottom = row;
+	if (_chartLastRow >= 0)
+	{
+		traceTop = std::min(row, _chartLastRow);
+		traceBottom = std::max(row, _chartLastRow);
+	}
+	_chartLastRow = row;
+	// The oldest column is on the left, its memory line becomes the new right column
+	uint16_t x = _chartLeft + _chartScroll;
+	_chartScroll = (_chartScroll + 1) % _chartWidth;
+	scrollAreaMove(_chartTFA, _chartWidth, _chartScroll, _chartReverse);
+	TFTsetAddrWindow(x, 0, x, _heightTFT - 1);
+	pushColorRun(_chartBgColor, traceTop);
+	pushColorRun(_chartTraceColor, traceBottom - traceTop + 1);
+	pushColorRun(_chartBgColor, (_heightTFT - 1) - traceBottom);
+}
+
+/*!
+	@brief Stop the strip chart
+	@note The scroll is reset and the chart columns are cleared to the chart background color.
+*/
+void ST7789_TFT::TFTchartEnd(void)
+{
+	if (_chartOn == false)
+		return;
+	_chartOn = false;
+	TFTVerticalScroll(_chartTFA);
+	fillRectClip(_chartLeft, 0, _chartWidth, _heightTFT, _chartBgColor);
+}
+
+/*!
+	@brief Stop the scrolling text console
+	@note The scroll is reset and the console rows are cleared to the text background color.
+*/
+void ST7789_TFT::TFTconsoleEnd(void)
+{
+	if (_consoleOn == false)
+		return;
+	_consoleOn = false;
+	TFTVerticalScroll(_consoleTFA);
+	fillRectClip(0, _consoleTop, _widthTFT, _consoleHeight, _textbgcolor);
+	TFTsetCursor(0, _consoleTop);
 }
 
 /*!
@@ -413,5 +1073,6 @@ void ST7789_TFT::TFTresetSWDisplay(void)
 {
   writeCommand(ST7789_SWRESET);
   TFT_MILLISEC_DELAY(5);
+  TFTAddrWindowInvalidate();
 }
 //**************** EOF *****************
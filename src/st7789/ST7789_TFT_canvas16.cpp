@@ -0,0 +1,107 @@
+/*!
+	@file     ST7789_TFT_canvas16.cpp
+	@author   Gavin Lyons
+	@brief    Source file for ST7789_TFT_PICO offscreen canvas.
+			  Draws with the graphics methods into a RGB565 RAM buffer
+	@note  See URL for full details.https://github.com/gavinlyonsrepo/ST7789_TFT_PICO
+*/
+
+#include "../../include/st7789/ST7789_TFT_canvas16.hpp"
+
+/*!
+	@brief Constructor for class ST7789_TFT_canvas16
+*/
+ST7789_TFT_canvas16::ST7789_TFT_canvas16(){}
+
+/*!
+	@brief Attach the canvas to a buffer and set its size
+	@param pBuffer user supplied array of at least w * h 565 16-bit colors
+	@param w canvas width in pixels
+	@param h canvas height in pixels
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=width or height is zero
+	@note The buffer is not cleared, call TFTfillScreen to do so.
+*/
+Display_Return_Codes_e ST7789_TFT_canvas16::TFTcanvasBegin(uint16_t *pBuffer, uint16_t w, uint16_t h)
+{
+	if (pBuffer == nullptr)
+	{
+		printf("Error TFTcanvasBegin 1: Buffer is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (w == 0 || h == 0)
+	{
+		printf("Error TFTcanvasBegin 2: Canvas size %ux%u is invalid\r\n", w, h);
+		return Display_BufferSize;
+	}
+	_widthTFT = _widthStartTFT = w;
+	_heightTFT = _heightStartTFT = h;
+	_colstart = _rowstart = _XStart = _YStart = 0;
+	_pFrameBuffer = pBuffer;
+	_pIndexBuffer = nullptr;
+	_fbWidth = w;
+	_fbHeight = h;
+	_fbRowOffset = 0;
+	_bandMode = false;
+	_fbWinValid = false;
+	return Display_Success;
+}
+
+/*!
+	@brief Set the canvas window the next pixels are written to
+	@param x0 left column
+	@param y0 top row
+	@param x1 right column
+	@param y1 bottom row
+	@note Windows work like the display RAM, but with no bus traffic.
+*/
+void ST7789_TFT_canvas16::TFTsetAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	frameBufferSetWindow(x0, y0, x1, y1);
+}
+
+/*!
+	@brief Copy the canvas to a display, or to another canvas
+	@param display destination, e.g. a ST7789_TFT object
+	@param x destination column of the canvas top left corner
+	@param y destination row of the canvas top left corner
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=TFTcanvasBegin not called
+		-# Display_BitmapScreenBounds=Co-ordinates out of bounds
+	@note Sent with one address window and, with DMA enabled, one DMA burst.
+		The burst may still be sending on return, call display.TFTDMAWait
+		before drawing into the canvas again. If the destination is in frame
+		buffer mode the canvas is copied into its frame buffer.
+*/
+Display_Return_Codes_e ST7789_TFT_canvas16::TFTcanvasPush(ST7789_TFT_graphics &display, uint16_t x, uint16_t y)
+{
+	if (_pFrameBuffer == nullptr)
+	{
+		printf("Error TFTcanvasPush 1: Canvas has no buffer\r\n");
+		return Display_BufferNullptr;
+	}
+	return display.TFTdrawBitmap16Buffer(x, y, _pFrameBuffer, _fbWidth, _fbHeight);
+}
+
+/*!
+	@brief Get the canvas buffer
+	@return pointer to the 565 16-bit colors, row by row, nullptr before TFTcanvasBegin
+*/
+uint16_t *ST7789_TFT_canvas16::TFTcanvasBuffer(void) { return _pFrameBuffer; }
+
+/*!
+	@brief Get the canvas width
+	@return width in pixels
+*/
+uint16_t ST7789_TFT_canvas16::TFTcanvasWidth(void) { return _fbWidth; }
+
+/*!
+	@brief Get the canvas height
+	@return height in pixels
+*/
+uint16_t ST7789_TFT_canvas16::TFTcanvasHeight(void) { return _fbHeight; }
+
+// ********************** EOF *********************
@@ -8,6 +8,17 @@
 #include "../../include/st7789/ST7789_TFT_graphics.hpp"
 #include "../../include/st7789/ST7789_TFT.hpp"
 #include "../../include/st7789/ST7789_TFT_Font.hpp"
+#include "ST7789_TFT_PIO.pio.h"
+#include <algorithm> // stable_sort, min, max, fill, copy
+
+// Default indexed frame buffer palette, 1 bpp uses the first 2 colors, 4 bpp the first 16
+static const uint16_t defaultPalette[] = {
+	ST7789_BLACK, ST7789_WHITE, ST7789_RED, ST7789_GREEN,
+	ST7789_BLUE, ST7789_YELLOW, ST7789_CYAN, ST7789_MAGENTA,
+	ST7789_ORANGE, ST7789_GREY, ST7789_DGREY, ST7789_LGREY,
+	ST7789_NAVY, ST7789_DGREEN, ST7789_MAROON, ST7789_PURPLE,
+	ST7789_TAN, ST7789_BROWN, ST7789_DCYAN, ST7789_OLIVE,
+	ST7789_GYELLOW, ST7789_PINK};
 
 /*!
 	@brief Construct a new st7789 tft graphics::st7789 tft graphics object
@@ -26,9 +37,8 @@ void ST7789_TFT_graphics ::TFTdrawPixel(uint16_t x, uint16_t y, uint16_t color)
 {
 	if ((x >= _widthTFT) || (y >= _heightTFT))
 		return;
-	TFTsetAddrWindow(x, y, x + 1, y + 1);
-	writeData(color >> 8);
-	writeData(color & 0xFF);
+	TFTsetAddrWindow(x, y, x, y);
+	pushColorRun(color, 1);
 }
 
 
@@ -42,7 +52,7 @@ void ST7789_TFT_graphics ::TFTdrawPixel(uint16_t x, uint16_t y, uint16_t color)
 	@return
 		-# Display_Success for success
 		-# Display_ShapeScreenBounds out of screen bounds
-	@note  uses spiWriteBuffer method
+	@note  uses pushColorRun method, DMA if enabled
 */
 Display_Return_Codes_e  ST7789_TFT_graphics::TFTfillRectBuffer(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
 {
@@ -58,26 +68,11 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTfillRectBuffer(uint16_t x, uint1
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
-	// Convert color to bytes
-	uint8_t hi = color >> 8;
-	uint8_t lo = color;
-
-	// Row buffer for one row of the rectangle
-	uint8_t rowBuffer[w * 2]; // Each pixel is 2 bytes (16-bit color)
-	// Fill the row buffer with the color
-	for (uint32_t i = 0; i < w; i++)
-	{
-		rowBuffer[2 * i] = hi;
-		rowBuffer[2 * i + 1] = lo;
-	}
-	// Draw the rectangle row by row
-	for (uint16_t j = 0; j < h; j++)
-	{
-		// Set the address window for the current row
-		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
-		// Write the row buffer to the display
-		spiWriteDataBuffer(rowBuffer, w * 2);
-	}
+	if (w == 0 || h == 0)
+		return Display_Success;
+	// One address window for the whole rectangle, color streamed into it
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	pushColorRun(color, (uint32_t)w * h);
 	return Display_Success;
 }
 
@@ -100,23 +95,12 @@ void ST7789_TFT_graphics ::TFTfillScreen(uint16_t color)
 */
 void ST7789_TFT_graphics ::TFTdrawFastVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color)
 {
-	uint8_t hi, lo;
-	if ((x >= _widthTFT) || (y >= _heightTFT))
+	if ((x >= _widthTFT) || (y >= _heightTFT) || h == 0)
 		return;
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
-	hi = color >> 8;
-	lo = color;
 	TFTsetAddrWindow(x, y, x, y + h - 1);
-	TFT_DC_SetHigh;
-
-	TFT_CS_SetLow;
-	while (h--)
-	{
-		spiWrite(hi);
-		spiWrite(lo);
-	}
-	TFT_CS_SetHigh;
+	pushColorRun(color, h);
 }
 
 /*!
@@ -128,22 +112,12 @@ void ST7789_TFT_graphics ::TFTdrawFastVLine(uint16_t x, uint16_t y, uint16_t h,
 */
 void ST7789_TFT_graphics ::TFTdrawFastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color)
 {
-	uint8_t hi, lo;
-	if ((x >= _widthTFT) || (y >= _heightTFT))
+	if ((x >= _widthTFT) || (y >= _heightTFT) || w == 0)
 		return;
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
-	hi = color >> 8;
-	lo = color;
 	TFTsetAddrWindow(x, y, x + w - 1, y);
-	TFT_DC_SetHigh;
-	TFT_CS_SetLow;
-	while (w--)
-	{
-		spiWrite(hi);
-		spiWrite(lo);
-	}
-	TFT_CS_SetHigh;
+	pushColorRun(color, w);
 }
 
 /*!
@@ -152,17 +126,17 @@ void ST7789_TFT_graphics ::TFTdrawFastHLine(uint16_t x, uint16_t y, uint16_t w,
 	@param y0 circle center y position
 	@param r radius of circle
 	@param color The color of the circle , 565 16 Bit color
+	@note Points with the same row in an octant are drawn as one horizontal run,
+		their mirror images as one vertical run.
 */
 void ST7789_TFT_graphics ::TFTdrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
-	int16_t f, ddF_x, ddF_y, x, y;
+	int16_t f, ddF_x, ddF_y, x, y, xStart, yPrev;
 	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
-	TFTdrawPixel(x0, y0 + r, color);
-	TFTdrawPixel(x0, y0 - r, color);
-	TFTdrawPixel(x0 + r, y0, color);
-	TFTdrawPixel(x0 - r, y0, color);
+	xStart = 0;
 	while (x < y)
 	{
+		yPrev = y;
 		if (f >= 0)
 		{
 			y--;
@@ -172,15 +146,13 @@ void ST7789_TFT_graphics ::TFTdrawCircle(int16_t x0, int16_t y0, int16_t r, uint
 		x++;
 		ddF_x += 2;
 		f += ddF_x;
-		TFTdrawPixel(x0 + x, y0 + y, color);
-		TFTdrawPixel(x0 - x, y0 + y, color);
-		TFTdrawPixel(x0 + x, y0 - y, color);
-		TFTdrawPixel(x0 - x, y0 - y, color);
-		TFTdrawPixel(x0 + y, y0 + x, color);
-		TFTdrawPixel(x0 - y, y0 + x, color);
-		TFTdrawPixel(x0 + y, y0 - x, color);
-		TFTdrawPixel(x0 - y, y0 - x, color);
+		if (y != yPrev)
+		{
+			drawCircleRuns(x0, y0, xStart, x - 1, yPrev, 0x0F, color);
+			xStart = x;
+		}
 	}
+	drawCircleRuns(x0, y0, xStart, x, y, 0x0F, color);
 }
 
 /*!
@@ -188,10 +160,12 @@ void ST7789_TFT_graphics ::TFTdrawCircle(int16_t x0, int16_t y0, int16_t r, uint
 */
 void ST7789_TFT_graphics ::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color)
 {
-	int16_t f, ddF_x, ddF_y, x, y;
+	int16_t f, ddF_x, ddF_y, x, y, xStart, yPrev;
 	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+	xStart = 1; // the helper skips the (0, r) point
 	while (x < y)
 	{
+		yPrev = y;
 		if (f >= 0)
 		{
 			y--;
@@ -201,27 +175,203 @@ void ST7789_TFT_graphics ::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, u
 		x++;
 		ddF_x += 2;
 		f += ddF_x;
-		if (cornername & 0x4)
+		if (y != yPrev && x > 1)
 		{
-			TFTdrawPixel(x0 + x, y0 + y, color);
-			TFTdrawPixel(x0 + y, y0 + x, color);
+			drawCircleRuns(x0, y0, xStart, x - 1, yPrev, cornername, color);
+			xStart = x;
 		}
-		if (cornername & 0x2)
+	}
+	if (x >= xStart)
+		drawCircleRuns(x0, y0, xStart, x, y, cornername, color);
+}
+
+/*!
+	@brief Used internally by TFTdrawCircle and drawCircleHelper, draws one group of octant points
+	@param x0 circle center x position
+	@param y0 circle center y position
+	@param xa first x offset of the group
+	@param xb last x offset of the group
+	@param yy y offset shared by the group
+	@param cornername quadrants to draw, 0x1 top left 0x2 top right 0x4 bottom right 0x8 bottom left
+	@param color 565 16-bit
+*/
+void ST7789_TFT_graphics ::drawCircleRuns(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t yy, uint8_t cornername, uint16_t color)
+{
+	int16_t len = xb - xa + 1;
+	if (cornername == 0x0F && xa == 0)
+	{
+		// Group touches the axes, left and right halves join into one run
+		fillRectClip(x0 - xb, y0 + yy, 2 * xb + 1, 1, color);
+		fillRectClip(x0 - xb, y0 - yy, 2 * xb + 1, 1, color);
+		fillRectClip(x0 + yy, y0 - xb, 1, 2 * xb + 1, color);
+		fillRectClip(x0 - yy, y0 - xb, 1, 2 * xb + 1, color);
+		return;
+	}
+	if (cornername & 0x4)
+	{
+		fillRectClip(x0 + xa, y0 + yy, len, 1, color);
+		fillRectClip(x0 + yy, y0 + xa, 1, len, color);
+	}
+	if (cornername & 0x2)
+	{
+		fillRectClip(x0 + xa, y0 - yy, len, 1, color);
+		fillRectClip(x0 + yy, y0 - xb, 1, len, color);
+	}
+	if (cornername & 0x8)
+	{
+		fillRectClip(x0 - xb, y0 + yy, len, 1, color);
+		fillRectClip(x0 - yy, y0 + xa, 1, len, color);
+	}
+	if (cornername & 0x1)
+	{
+		fillRectClip(x0 - xb, y0 - yy, len, 1, color);
+		fillRectClip(x0 - yy, y0 - xb, 1, len, color);
+	}
+}
+
+/*!
+	@brief fills a rectangle, clipped to the screen on all sides
+	@param x x start coordinate, may be negative
+	@param y y start coordinate, may be negative
+	@param w width of the rectangle
+	@param h height of the rectangle
+	@param color 565 16-bit
+	@note Used internally for runs and spans, silently draws nothing if fully off screen
+*/
+void ST7789_TFT_graphics ::fillRectClip(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if (w <= 0 || h <= 0 || x >= _widthTFT || y >= _heightTFT)
+		return;
+	if (x + w > _widthTFT)
+		w = _widthTFT - x;
+	if (y + h > _heightTFT)
+		h = _heightTFT - y;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	pushColorRun(color, (uint32_t)w * h);
+}
+
+/*!
+	@brief Draw a batch of pixels with the fewest address windows
+	@param pPixels array of pixels, sorted in place into row order
+	@param count number of pixels
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+	@note Pixels next to each other on a row are joined into one span and sent
+		in one window. Off screen pixels are skipped. Where a co-ordinate is
+		repeated the last entry in the array is drawn.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTdrawPixels(TFT_Pixel_t *pPixels, uint16_t count)
+{
+	if (pPixels == nullptr)
+	{
+		printf("Error TFTdrawPixels 1: Pixel array is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	std::stable_sort(pPixels, pPixels + count, [](const TFT_Pixel_t &a, const TFT_Pixel_t &b)
+					 { return (a.y < b.y) || (a.y == b.y && a.x < b.x); });
+
+	uint16_t span[TFT_PIXEL_SPAN_MAX];
+	uint16_t i = 0;
+	while (i < count)
+	{
+		int16_t xStart = pPixels[i].x;
+		int16_t yRow = pPixels[i].y;
+		if (xStart < 0 || yRow < 0 || xStart >= _widthTFT || yRow >= _heightTFT)
+		{
+			i++;
+			continue;
+		}
+		uint16_t n = 0;
+		bool uniform = true;
+		while (i < count && pPixels[i].y == yRow)
+		{
+			if (n > 0 && pPixels[i].x == xStart + n - 1)
+			{
+				span[n - 1] = pPixels[i++].color; // repeated co-ordinate, later entry wins
+				continue;
+			}
+			if (n == TFT_PIXEL_SPAN_MAX || pPixels[i].x != xStart + n || pPixels[i].x >= _widthTFT)
+				break;
+			span[n++] = pPixels[i++].color;
+		}
+		for (uint16_t k = 1; k < n && uniform; k++)
+			uniform = (span[k] == span[0]);
+		TFTsetAddrWindow(xStart, yRow, xStart + n - 1, yRow);
+		if (uniform)
 		{
-			TFTdrawPixel(x0 + x, y0 - y, color);
-			TFTdrawPixel(x0 + y, y0 - x, color);
+			pushColorRun(span[0], n);
 		}
-		if (cornername & 0x8)
+		else
 		{
-			TFTdrawPixel(x0 - y, y0 + x, color);
-			TFTdrawPixel(x0 - x, y0 + y, color);
+			pushPixels16(span, n);
+			TFTDMAWait(); // span is reused
 		}
-		if (cornername & 0x1)
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief Draw a batch of horizontal and vertical runs with the fewest address windows
+	@param pRuns array of runs, sorted in place by direction, line and start
+	@param count number of runs
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+	@note Runs of one color that touch or overlap on the same row or column are
+		joined into one window. Runs are clipped to the screen. The draw order of
+		overlapping runs of different colors is not defined.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTdrawRuns(TFT_Run_t *pRuns, uint16_t count)
+{
+	if (pRuns == nullptr)
+	{
+		printf("Error TFTdrawRuns 1: Run array is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	// Key each run by the line it lies on and its start along that line
+	std::stable_sort(pRuns, pRuns + count, [](const TFT_Run_t &a, const TFT_Run_t &b)
+					 {
+		int16_t lineA = a.vertical ? a.x : a.y, lineB = b.vertical ? b.x : b.y;
+		int16_t startA = a.vertical ? a.y : a.x, startB = b.vertical ? b.y : b.x;
+		if (a.vertical != b.vertical)
+			return b.vertical;
+		return (lineA < lineB) || (lineA == lineB && startA < startB); });
+
+	uint16_t i = 0;
+	while (i < count)
+	{
+		TFT_Run_t run = pRuns[i++];
+		int32_t start = run.vertical ? run.y : run.x;
+		int32_t end = start + run.length;
+		while (i < count && pRuns[i].vertical == run.vertical && pRuns[i].color == run.color)
 		{
-			TFTdrawPixel(x0 - y, y0 - x, color);
-			TFTdrawPixel(x0 - x, y0 - y, color);
+			const TFT_Run_t &next = pRuns[i];
+			int32_t nextStart = next.vertical ? next.y : next.x;
+			bool sameLine = run.vertical ? (next.x == run.x) : (next.y == run.y);
+			if (!sameLine || nextStart > end)
+				break;
+			if (nextStart + next.length > end)
+				end = nextStart + next.length;
+			i++;
 		}
+		int16_t len = (end - start > INT16_MAX) ? INT16_MAX : (int16_t)(end - start);
+		if (run.vertical)
+			fillRectClip(run.x, start, 1, len, run.color);
+		else
+			fillRectClip(start, run.y, len, 1, run.color);
 	}
+	return Display_Success;
 }
 
 /*!
@@ -292,10 +442,18 @@ void ST7789_TFT_graphics ::TFTdrawRectWH(uint16_t x, uint16_t y, uint16_t w, uin
 	@param x1 x end coordinate
 	@param y1 y end coordinate
 	@param color color to fill  rectangle 565 16-bit
+	@note Bresenham, each run of pixels along the major axis is sent as one
+		window. Lines fully off screen are rejected by their outcodes, the parts
+		of a line before and after the screen are skipped without stepping
+		through them. End points are not moved so the pixels drawn match the
+		unclipped line.
 */
 void ST7789_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
 {
 	int16_t steep, dx, dy, err, ystep;
+	// Trivial reject, both ends outside the same screen edge
+	if ((lineOutCode(x0, y0) & lineOutCode(x1, y1)) != 0)
+		return;
 	steep = abs(y1 - y0) > abs(x1 - x0);
 	if (steep)
 	{
@@ -320,23 +478,93 @@ void ST7789_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16
 		ystep = -1;
 	}
 
+	// Screen size along the major (x) and minor (y) axis after the steep swap
+	int16_t majorMax = steep ? _heightTFT : _widthTFT;
+	int16_t minorMax = steep ? _widthTFT : _heightTFT;
+
+	// Skip ahead to the first step that can be on screen
+	int32_t skip = (x0 < 0) ? -x0 : 0;
+	int32_t minorSteps = 0; // minor axis steps needed to reach the screen
+	if (y0 < 0)
+		minorSteps = -y0;
+	else if (y0 >= minorMax)
+		minorSteps = y0 - minorMax + 1;
+	if (minorSteps > 0)
+	{
+		if (dy == 0 || (ystep > 0) != (y0 < 0))
+			return; // moving away from the screen
+		int32_t minorSkip = ((int32_t)(err) + (minorSteps - 1) * dx) / dy + 1;
+		if (minorSkip > skip)
+			skip = minorSkip;
+	}
+	if (skip > dx)
+		return;
+	if (skip > 0)
+	{
+		// Bresenham state after skip steps, err stays in [0, dx)
+		int32_t moved = (int32_t)skip * dy - err;
+		int32_t ySteps = (moved > 0) ? (moved + dx - 1) / dx : 0;
+		err = err - skip * dy + ySteps * dx;
+		x0 += skip;
+		y0 += ystep * ySteps;
+		if (y0 < 0 || y0 >= minorMax)
+			return; // crossed the screen corner before reaching it
+	}
+	if (x1 >= majorMax)
+		x1 = majorMax - 1;
+
+	int16_t runStart = x0;
 	for (; x0 <= x1; x0++)
 	{
-		if (steep)
-		{
-			TFTdrawPixel(y0, x0, color);
-		}
-		else
-		{
-			TFTdrawPixel(x0, y0, color);
-		}
 		err -= dy;
 		if (err < 0)
 		{
+			drawLineRun(runStart, x0, y0, steep, color);
 			y0 += ystep;
 			err += dx;
+			runStart = x0 + 1;
+			if (y0 < 0 || y0 >= minorMax)
+				return; // left the screen on the minor axis
 		}
 	}
+	if (runStart <= x1)
+		drawLineRun(runStart, x1, y0, steep, color);
+}
+
+/*!
+	@brief Used internally by TFTdrawLine, draws one run along the major axis
+	@param start first major axis coordinate
+	@param end last major axis coordinate
+	@param minor minor axis coordinate
+	@param steep true if the major axis is y
+	@param color 565 16-bit
+*/
+void ST7789_TFT_graphics ::drawLineRun(int16_t start, int16_t end, int16_t minor, bool steep, uint16_t color)
+{
+	if (steep)
+		fillRectClip(minor, start, 1, end - start + 1, color);
+	else
+		fillRectClip(start, minor, end - start + 1, 1, color);
+}
+
+/*!
+	@brief Used internally by TFTdrawLine, Cohen-Sutherland outcode of a point
+	@param x x coordinate
+	@param y y coordinate
+	@return bit 0 left, bit 1 right, bit 2 above, bit 3 below the screen, 0 if on screen
+*/
+uint8_t ST7789_TFT_graphics ::lineOutCode(int16_t x, int16_t y)
+{
+	uint8_t code = 0;
+	if (x < 0)
+		code |= 0x01;
+	else if (x >= _widthTFT)
+		code |= 0x02;
+	if (y < 0)
+		code |= 0x04;
+	else if (y >= _heightTFT)
+		code |= 0x08;
+	return code;
 }
 
 /*!
@@ -349,11 +577,14 @@ void ST7789_TFT_graphics ::TFTdrawLine(int16_t x0, int16_t y0, int16_t x1, int16
 */
 void ST7789_TFT_graphics ::TFTfillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
 {
-	int16_t i;
-	for (i = x; i < x + w; i++)
-	{
-		TFTdrawFastVLine(i, y, h, color);
-	}
+	if ((x >= _widthTFT) || (y >= _heightTFT) || w == 0 || h == 0)
+		return;
+	if ((x + w - 1) >= _widthTFT)
+		w = _widthTFT - x;
+	if ((y + h - 1) >= _heightTFT)
+		h = _heightTFT - y;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	pushColorRun(color, (uint32_t)w * h);
 }
 
 /*!
@@ -500,17 +731,25 @@ void ST7789_TFT_graphics ::TFTfillTriangle(int16_t x0, int16_t y0, int16_t x1, i
 	@param size 1-15
 	@return
 		-# Display_Success 
-		-# Display_WrongFont = Wrong font This Function for font #1-6 only.
+		-# Display_WrongFont = Wrong font This Function for font #1-6 only,
+			a proportional font is drawn with the overload without size.
 		-# Display_CharScreenBounds = X  Y Co-ordinates out of bounds.
 		-# Display_CharFontASCIIRange = ASCII character not in fonts range.
 
 	@note Function Overloaded 2 off , the other drawChar method is for fonts > 6
+		An opaque glyph fully on screen is sent as one window, from the glyph
+		cache if set with TFTsetGlyphCache.
 */
 Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawChar(uint16_t x, uint16_t y, uint8_t character, uint16_t color, uint16_t bg, uint8_t size)
 {
 
 	int8_t i, j;
 	uint8_t line;
+	if (_pGFXFont != nullptr)
+	{
+		printf("Error TFTdrawChar 6: Proportional font set, use TFTdrawChar without size\r\n");
+		return Display_WrongFont;
+	}
 	// 0. Check size
 	if (size == 0 || size >= 15)
 		size = 1;
@@ -531,148 +770,793 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawChar(uint16_t x, uint16_t y
 		return Display_CharFontASCIIRange;
 	}
 
-	for (i = 0; i < (_CurrentFontWidth + 1); i++)
+	const uint8_t *pColumns = fontGlyph(character);
+	if (_FontNumber >= TFTFont_Bignum || pColumns == nullptr)
 	{
+		printf("Error TFTdrawChar 5: Wrong font number set must be 1-6 : %u \r\n", _FontNumber);
+		return Display_WrongFont;
+	}
 
-		if (i == _CurrentFontWidth)
+	// 3. Opaque glyph fully on screen, one window from the cache or the stack
+	uint16_t w = (_CurrentFontWidth + 1) * size;
+	uint16_t h = _CurrentFontheight * size;
+	if (bg != color && (x + w) <= _widthTFT && (y + h) <= _heightTFT)
+	{
+		uint16_t *pGlyph = glyphCacheFind(pColumns, character, color, bg, size);
+		if (pGlyph != nullptr)
 		{
-			line = 0x00;
+			TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+			pushPixels16(pGlyph, (uint32_t)w * h);
+			return Display_Success;
 		}
-		else
+		if ((uint32_t)w * h <= TFT_GLYPH_STACK_PIXELS)
 		{
-			switch (_FontNumber)
-			{
-			case TFTFont_Default:
-				line = pFontDefaultptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Thick:
-				line = pFontThickptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Seven_Seg:
-				line = pFontSevenSegptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Wide:
-				line = pFontWideptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_Tiny:
-				line = pFontTinyptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			case TFTFont_HomeSpun:
-				line = pFontHomeSpunptr[(character - _CurrentFontoffset) * _CurrentFontWidth + i];
-				break;
-			default:
-				printf("Error TFTdrawChar 5: Wrong font number set must be 1-6 : %u \r\n", _FontNumber);
-				return Display_WrongFont;
-				break;
-			}
+			uint16_t glyph[TFT_GLYPH_STACK_PIXELS];
+			glyphRaster(pColumns, color, bg, size, glyph);
+			TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+			pushPixels16(glyph, (uint32_t)w * h);
+			TFTDMAWait();
+			return Display_Success;
 		}
-		for (j = 0; j < _CurrentFontheight; j++, line >>= 1)
+	}
+
+	// 4. Transparent, clipped or large glyph, columns drawn as runs
+	for (i = 0; i < (_CurrentFontWidth + 1); i++)
+	{
+		line = (i == _CurrentFontWidth) ? 0x00 : pColumns[i];
+		// Column drawn as vertical runs of set and clear bits
+		j = 0;
+		while (j < _CurrentFontheight)
 		{
-			if (line & 0x01)
+			bool bitOn = line & 0x01;
+			int8_t runStart = j;
+			while (j < _CurrentFontheight && (bool)(line & 0x01) == bitOn)
 			{
-				if (size == 1)
-					TFTdrawPixel(x + i, y + j, color);
-				else
-					TFTfillRect(x + (i * size), y + (j * size), size, size, color);
+				j++;
+				line >>= 1;
 			}
+			if (bitOn)
+				fillRectClip(x + i * size, y + runStart * size, size, (j - runStart) * size, color);
 			else if (bg != color)
-			{
-				if (size == 1)
-					TFTdrawPixel(x + i, y + j, bg);
-				else
-					TFTfillRect(x + i * size, y + j * size, size, size, bg);
-			}
+				fillRectClip(x + i * size, y + runStart * size, size, (j - runStart) * size, bg);
 		}
 	}
 	return Display_Success;
 }
 
 /*!
-	@brief turn on or off screen wrap of the text (fonts 1-6)
-	@param w TRUE on
+	@brief Column data of a character in the current font
+	@param character ASCII character, already checked against the font range
+	@return pointer to the glyph columns, nullptr if the font is not enabled
+	@note Fonts 1-6 have one byte per column, bit 0 the top row. Fonts 7-12
+		have (height + 7) / 8 bytes per column, MSB first from the top row.
 */
-void ST7789_TFT_graphics ::TFTsetTextWrap(bool w)
+const uint8_t *ST7789_TFT_graphics::fontGlyph(uint8_t character)
 {
-	_wrap = w;
+	uint8_t index = character - _CurrentFontoffset;
+	switch (_FontNumber)
+	{
+	case TFTFont_Default: return pFontDefaultptr + index * _CurrentFontWidth;
+	case TFTFont_Thick: return pFontThickptr + index * _CurrentFontWidth;
+	case TFTFont_Seven_Seg: return pFontSevenSegptr + index * _CurrentFontWidth;
+	case TFTFont_Wide: return pFontWideptr + index * _CurrentFontWidth;
+	case TFTFont_Tiny: return pFontTinyptr + index * _CurrentFontWidth;
+	case TFTFont_HomeSpun: return pFontHomeSpunptr + index * _CurrentFontWidth;
+	case TFTFont_Bignum: return pFontBigNum16x32ptr[index];
+	case TFTFont_Mednum: return pFontMedNum16x16ptr[index];
+#ifdef _TFT_OPTIONAL_FONT_9
+	case TFTFont_ArialRound: return pFontArial16x24ptr[index];
+#endif
+#ifdef _TFT_OPTIONAL_FONT_10
+	case TFTFont_ArialBold: return pFontArial16x16ptr[index];
+#endif
+#ifdef _TFT_OPTIONAL_FONT_11
+	case TFTFont_Mia: return pFontMia8x16ptr[index];
+#endif
+#ifdef _TFT_OPTIONAL_FONT_12
+	case TFTFont_Dedica: return pFontDedica6x12ptr[index];
+#endif
+	default: return nullptr;
+	}
 }
 
 /*!
-	@brief Writes text string on the TFT
-	@param x X coordinate
+	@brief Expand a fonts 1-6 glyph to RGB565 pixels, row by row
+	@param pColumns column data from fontGlyph
+	@param color foreground 565 color
+	@param bg background 565 color
+	@param size text size
+	@param pOut (_CurrentFontWidth + 1) * size by _CurrentFontheight * size
+		pixels, includes the blank column to the right of the glyph.
+*/
+void ST7789_TFT_graphics::glyphRaster(const uint8_t *pColumns, uint16_t color, uint16_t bg, uint8_t size, uint16_t *pOut)
+{
+	uint16_t w = (_CurrentFontWidth + 1) * size;
+	for (uint8_t row = 0; row < _CurrentFontheight; row++)
+	{
+		glyphRasterRow(pColumns, color, bg, size, row, pOut);
+		// Repeat the row for the rest of the text size
+		for (uint8_t k = 1; k < size; k++)
+			std::copy(pOut, pOut + w, pOut + k * w);
+		pOut += w * size;
+	}
+}
+
+/*!
+	@brief Expand one font row of a glyph to RGB565 pixels
+	@param pColumns column data from fontGlyph
+	@param color foreground 565 color
+	@param bg background 565 color
+	@param size text size, fonts 1-6 only, each pixel is repeated size times
+	@param row font row, 0 to _CurrentFontheight - 1
+	@param pOut one glyph cell wide, fonts 1-6 include the blank column
+*/
+void ST7789_TFT_graphics::glyphRasterRow(const uint8_t *pColumns, uint16_t color, uint16_t bg, uint8_t size, uint8_t row, uint16_t *pOut)
+{
+	if (_FontNumber >= TFTFont_Bignum)
+	{
+		uint8_t columnBytes = (_CurrentFontheight + 7) / 8;
+		const uint8_t *pByte = pColumns + row / 8;
+		uint8_t mask = 0x80 >> (row % 8);
+		for (uint8_t col = 0; col < _CurrentFontWidth; col++)
+		{
+			*pOut++ = (*pByte & mask) ? color : bg;
+			pByte += columnBytes;
+		}
+		return;
+	}
+	for (uint8_t col = 0; col < _CurrentFontWidth; col++)
+	{
+		uint16_t pixel = (pColumns[col] >> row) & 0x01 ? color : bg;
+		std::fill(pOut, pOut + size, pixel);
+		pOut += size;
+	}
+	std::fill(pOut, pOut + size, bg);
+}
+
+/*!
+	@brief Count the leading characters of a string that can be sent as one text run
+	@param x X coordinate of the first character
 	@param y Y coordinate
-	@param pText pointer to string/array
-	@param color 565 16-bit
-	@param bg background color
-	@param size 1-x
-	@return
-		-# Display_Success=success
-		-# Display_WrongFont=wrong font
-		-# Display_CharScreenBounds=Co-ordinates out of bounds
-		-# Display_CharArrayNullptr=Invalid pointer object
-		-# if TFTdrawChar method error upstream it return that error code.
-	@note for font #1-6 only
+	@param pText characters
+	@param length number of characters in pText
+	@param color foreground 565 color
+	@param bg background 565 color
+	@param size text size, fonts 1-6 only
+	@param right the run ends before a character cell would pass this column
+	@return number of characters, 0 if the first character must be drawn on its own
+	@note A run stops at a control or out of range character, and after
+		TFT_TEXT_RUN_MAX characters or TFT_TEXT_ROW_PIXELS pixels, the rest of
+		the line then goes as further runs. Transparent text (bg == color)
+		and runs off the bottom of the screen return 0.
 */
-Display_Return_Codes_e ST7789_TFT_graphics ::TFTdrawText(uint16_t x, uint16_t y, char *pText, uint16_t color, uint16_t bg, uint8_t size)
+uint16_t ST7789_TFT_graphics::textRunMeasure(uint16_t x, uint16_t y, const uint8_t *pText, uint16_t length, uint16_t color, uint16_t bg, uint8_t size, uint16_t right)
 {
+	bool large = (_FontNumber >= TFTFont_Bignum);
+	if (large)
+		size = 1;
+	else if (bg == color || size == 0 || size >= 15)
+		return 0;
+	if (y + _CurrentFontheight * size > _heightTFT)
+		return 0;
+	uint16_t cellWidth = large ? _CurrentFontWidth : (_CurrentFontWidth + 1) * size;
+	uint16_t count = 0;
+	uint16_t w = cellWidth;
+	while (count < length && count < TFT_TEXT_RUN_MAX && w <= TFT_TEXT_ROW_PIXELS && x + cellWidth <= right)
+	{
+		uint8_t character = pText[count];
+		if (character == '\n' || character == '\r' ||
+			character < _CurrentFontoffset || character >= (_CurrentFontLength + _CurrentFontoffset) ||
+			fontGlyph(character) == nullptr)
+			break;
+		x += cellWidth;
+		w += cellWidth;
+		count++;
+	}
+	return count;
+}
 
-	// Check if correct font
+/*!
+	@brief Draw a run of characters on one text line as one window
+	@param x X coordinate
+	@param y Y coordinate
+	@param pText characters, checked by textRunMeasure
+	@param count number of characters from textRunMeasure, at most TFT_TEXT_RUN_MAX
+	@param color foreground 565 color
+	@param bg background 565 color
+	@param size text size, fonts 1-6 only
+	@note Each pixel row of the run is built across all its characters into
+		one of two row buffers and sent while the next row is built.
+		textRunMeasure keeps the run within TFT_TEXT_ROW_PIXELS.
+*/
+void ST7789_TFT_graphics::textRunDraw(uint16_t x, uint16_t y, const uint8_t *pText, uint16_t count, uint16_t color, uint16_t bg, uint8_t size)
+{
 	if (_FontNumber >= TFTFont_Bignum)
+		size = 1;
+	uint16_t cellWidth = (_FontNumber >= TFTFont_Bignum) ? _CurrentFontWidth : (_CurrentFontWidth + 1) * size;
+	uint16_t w = cellWidth * count;
+	const uint8_t *pColumns[TFT_TEXT_RUN_MAX];
+	for (uint16_t i = 0; i < count; i++)
+		pColumns[i] = fontGlyph(pText[i]);
+	uint16_t rowBuffer[2][TFT_TEXT_ROW_PIXELS];
+
+	TFTsetAddrWindow(x, y, x + w - 1, y + _CurrentFontheight * size - 1);
+	for (uint8_t row = 0; row < _CurrentFontheight; row++)
 	{
-		printf("Error TFTdrawText 2: Wrong font number selected, must be 1-6\r\n");
-		return Display_WrongFont;
+		uint16_t *pRow = rowBuffer[row & 1];
+		for (uint16_t i = 0; i < count; i++)
+			glyphRasterRow(pColumns[i], color, bg, size, row, pRow + i * cellWidth);
+		for (uint8_t k = 0; k < size; k++)
+			pushPixels16(pRow, w);
 	}
-	// Check for null pointer
-	if (pText == nullptr)
+	TFTDMAWait();
+}
+
+/*!
+	@brief Set a proportional font, in the Adafruit GFX font format
+	@param pFont font, stays in use until TFTFontNum or TFTsetFontGFX is called
+	@return
+		-# Display_Success=success
+		-# Display_FontPtrNullptr=invalid font pointer
+		-# Display_WrongFont=bits per pixel not 1, 2 or 4, or a glyph wider than TFT_GFX_GLYPH_WIDTH_MAX
+	@note Drawn with the TFTdrawChar, TFTdrawText overloads without a size
+		parameter and print. y is the top of the text line, the baseline is
+		the tallest glyph below it, lines are yAdvance apart. Each run of
+		text on a line is sent as one window around its inked pixels, bg
+		fills the gaps inside it. bg == color draws the ink only.
+		Anti-aliased 2 and 4 bpp fonts are blended against bg, which should
+		be the color behind the text. Drawn transparent they have no
+		background to blend with, coverage of half or more is drawn as ink.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTsetFontGFX(const TFT_GFXfont_t *pFont)
+{
+	if (pFont == nullptr || pFont->bitmap == nullptr || pFont->glyph == nullptr || pFont->last < pFont->first)
 	{
-		printf("Error TFTdrawText 3: String array is not valid pointer object\r\n");
-		return Display_CharArrayNullptr;
+		printf("Error TFTsetFontGFX 1: Font is not valid pointer object\r\n");
+		return Display_FontPtrNullptr;
 	}
-	// Out of screen bounds
-	if ((x >= _widthTFT) || (y >= _heightTFT))
+	if (pFont->bpp != 1 && pFont->bpp != 2 && pFont->bpp != 4)
 	{
-		printf("Error TFTdrawText 4: Out of screen bounds\r\n");
-		return Display_CharScreenBounds;
+		printf("Error TFTsetFontGFX 2: Bits per pixel %u must be 1, 2 or 4\r\n", pFont->bpp);
+		return Display_WrongFont;
 	}
-	uint8_t cursorX = x;
-	uint8_t cursorY = y;
-	Display_Return_Codes_e  errorCode;
-	while (*pText != '\0')
+	int8_t top = 0;
+	for (uint16_t i = 0; i <= pFont->last - pFont->first; i++)
 	{
-		if (_wrap && ((cursorX + size * _CurrentFontWidth) > _widthTFT))
-		{
-			cursorX = 0;
-			cursorY = cursorY + size * 7 + 3;
-			if (cursorY > _heightTFT)
-				cursorY = _heightTFT;
-		}
-		errorCode = TFTdrawChar(cursorX, cursorY, *pText, color, bg, size);
-		if ( errorCode != Display_Success)
+		if (pFont->glyph[i].width > TFT_GFX_GLYPH_WIDTH_MAX)
 		{
-			printf("Error TFTdrawText 5: Method TFTdrawChar failed\r\n");
-			return errorCode;
+			printf("Error TFTsetFontGFX 3: Glyph %u is %u wide, the most is %u\r\n", pFont->first + i, pFont->glyph[i].width, TFT_GFX_GLYPH_WIDTH_MAX);
+			return Display_WrongFont;
 		}
-		cursorX = cursorX + size * (_CurrentFontWidth + 1);
-
-		if (cursorX > _widthTFT)
-			cursorX = _widthTFT;
-		pText++;
+		top = std::min(top, pFont->glyph[i].yOffset);
 	}
+	_pGFXFont = pFont;
+	_gfxRampBpp = 0;
+	_gfxAscent = -top;
 	return Display_Success;
 }
 
 /*!
-	@brief: called by the print class after it converts the data to a character
-	@param character character
+	@brief Glyph of a character in the proportional font
+	@param character ASCII character
+	@return glyph entry, nullptr if the character is not in the font
 */
-size_t ST7789_TFT_graphics ::write(uint8_t character)
+const TFT_GFXglyph_t *ST7789_TFT_graphics::gfxGlyph(uint8_t character)
 {
-	if (_FontNumber < TFTFont_Bignum)
+	if (character < _pGFXFont->first || character > _pGFXFont->last)
+		return nullptr;
+	return &_pGFXFont->glyph[character - _pGFXFont->first];
+}
+
+/*!
+	@brief Kerning between two characters of the proportional font
+	@param left first character
+	@param right following character
+	@return pixels added to the advance of left, 0 if the pair is not in the table
+*/
+int8_t ST7789_TFT_graphics::gfxKern(uint8_t left, uint8_t right)
+{
+	const TFT_GFXkern_t *pKern = _pGFXFont->kern;
+	if (pKern == nullptr)
+		return 0;
+	uint16_t key = (left << 8) | right;
+	uint16_t low = 0, high = _pGFXFont->kernCount;
+	while (low < high)
+	{
+		uint16_t mid = (low + high) / 2;
+		uint16_t midKey = (pKern[mid].left << 8) | pKern[mid].right;
+		if (midKey == key)
+			return pKern[mid].adjust;
+		if (midKey < key)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return 0;
+}
+
+/*!
+	@brief Read the coverage levels of one proportional glyph row
+	@param pGlyph glyph entry
+	@param reader read position, pData set to the glyph bitmap before the first row
+	@param row bitmap row, 0 to height - 1, rows of a run length encoded
+		bitmap must be read in order, rows skipped over are decoded and dropped
+	@param pLevels glyph width coverage levels, 0 to 2^bpp - 1
+*/
+void ST7789_TFT_graphics::gfxReadRow(const TFT_GFXglyph_t *pGlyph, TFT_GFXreader_t &reader, uint8_t row, uint8_t *pLevels)
+{
+	uint8_t bpp = _pGFXFont->bpp;
+	uint8_t levelMax = (1 << bpp) - 1;
+	if (_pGFXFont->rle == false)
+	{
+		uint32_t bit = (uint32_t)row * pGlyph->width * bpp;
+		for (uint8_t col = 0; col < pGlyph->width; col++, bit += bpp)
+			pLevels[col] = (reader.pData[bit >> 3] >> (8 - bpp - (bit & 7))) & levelMax;
+		return;
+	}
+	uint8_t lengthMask = 0xFF >> bpp;
+	for (; reader.row <= row; reader.row++)
+	{
+		for (uint8_t col = 0; col < pGlyph->width; col++)
+		{
+			if (reader.runLeft == 0)
+			{
+				reader.level = *reader.pData >> (8 - bpp);
+				reader.runLeft = (*reader.pData & lengthMask) + 1;
+				reader.pData++;
+			}
+			pLevels[col] = reader.level;
+			reader.runLeft--;
+		}
+	}
+}
+
+/*!
+	@brief Set the inked pixels of one proportional glyph row in a row buffer
+	@param pGlyph glyph entry
+	@param reader read position, see gfxReadRow
+	@param row bitmap row, 0 to height - 1
+	@param pRamp coverage level to 565 color, from gfxRamp
+	@param pOut row buffer, pixels with no coverage are left as they are
+	@param offset buffer position of the left edge of the glyph, may be negative
+	@param width row buffer width, ink outside it is dropped
+*/
+void ST7789_TFT_graphics::gfxRasterRow(const TFT_GFXglyph_t *pGlyph, TFT_GFXreader_t &reader, uint8_t row, const uint16_t *pRamp, uint16_t *pOut, int16_t offset, uint16_t width)
+{
+	uint8_t levels[TFT_GFX_GLYPH_WIDTH_MAX];
+	gfxReadRow(pGlyph, reader, row, levels);
+	for (uint8_t col = 0; col < pGlyph->width; col++)
+	{
+		int16_t x = offset + col;
+		if (levels[col] != 0 && x >= 0 && x < width)
+			pOut[x] = pRamp[levels[col]];
+	}
+}
+
+/*!
+	@brief Get the coverage level to color ramp of the proportional font
+	@param color 565 16-bit foreground color
+	@param bg 565 16-bit background color
+	@return 2^bpp entries, level 0 is bg and the last level color
+	@note Rebuilt only when the colors or the font bits per pixel change,
+		so drawing blends with a table lookup per pixel.
+*/
+const uint16_t *ST7789_TFT_graphics::gfxRamp(uint16_t color, uint16_t bg)
+{
+	uint8_t bpp = _pGFXFont->bpp;
+	if (_gfxRampBpp == bpp && _gfxRampColor == color && _gfxRampBg == bg)
+		return _gfxRamp;
+	uint8_t levelMax = (1 << bpp) - 1;
+	for (uint8_t level = 0; level <= levelMax; level++)
+	{
+		// Blend the red, green and blue fields on their own, rounded to nearest
+		uint16_t blended = 0;
+		const uint8_t fieldShift[3] = {11, 5, 0};
+		const uint8_t fieldMask[3] = {0x1F, 0x3F, 0x1F};
+		for (uint8_t f = 0; f < 3; f++)
+		{
+			uint16_t fg = (color >> fieldShift[f]) & fieldMask[f];
+			uint16_t back = (bg >> fieldShift[f]) & fieldMask[f];
+			uint16_t field = (fg * level + back * (levelMax - level) + levelMax / 2) / levelMax;
+			blended |= field << fieldShift[f];
+		}
+		_gfxRamp[level] = blended;
+	}
+	_gfxRampColor = color;
+	_gfxRampBg = bg;
+	_gfxRampBpp = bpp;
+	return _gfxRamp;
+}
+
+/*!
+	@brief Count the leading characters of a string that go on one proportional font text line
+	@param x X coordinate of the pen
+	@param pText characters
+	@param length number of characters in pText
+	@return number of characters, 0 at a line break, a character not in the
+		font or if the first character wraps to the next line
+	@note With wrap on the run ends before a character would pass the right
+		edge of the screen. Off screen characters go one at a time.
+*/
+uint16_t ST7789_TFT_graphics::gfxRunMeasure(int16_t x, const uint8_t *pText, uint16_t length)
+{
+	uint16_t count = 0;
+	int16_t pen = x;
+	while (count < length && count < TFT_GFX_RUN_MAX)
+	{
+		uint8_t character = pText[count];
+		const TFT_GFXglyph_t *pGlyph = gfxGlyph(character);
+		if (character == '\n' || character == '\r' || pGlyph == nullptr)
+			break;
+		int16_t next = pen + (count > 0 ? gfxKern(pText[count - 1], character) : 0);
+		if (count > 0 && next >= (int16_t)_widthTFT)
+			break;
+		next += pGlyph->xAdvance;
+		if (_wrap && next > (int16_t)_widthTFT && (count > 0 || x > 0))
+			break;
+		pen = next;
+		count++;
+	}
+	return count;
+}
+
+/*!
+	@brief Draw a run of proportional font characters on one text line
+	@param x X coordinate of the pen
+	@param y Y coordinate of the top of the text line
+	@param pText characters, checked by gfxRunMeasure
+	@param count number of characters, at most TFT_GFX_RUN_MAX
+	@param color 565 16-bit color
+	@param bg background color, bg == color draws the ink only
+	@return X coordinate of the pen after the run
+	@note The run is sent as one window around the boxes of its glyphs,
+		clipped to the screen, built a row at a time in two row buffers.
+		A window wider than TFT_TEXT_ROW_PIXELS is sent as several.
+*/
+int16_t ST7789_TFT_graphics::gfxRunDraw(int16_t x, int16_t y, const uint8_t *pText, uint16_t count, uint16_t color, uint16_t bg)
+{
+	const TFT_GFXglyph_t *pGlyphs[TFT_GFX_RUN_MAX];
+	TFT_GFXreader_t readers[TFT_GFX_RUN_MAX];
+	int16_t left[TFT_GFX_RUN_MAX];
+	int16_t baseline = y + _gfxAscent;
+	int16_t x0 = INT16_MAX, x1 = INT16_MIN, y0 = INT16_MAX, y1 = INT16_MIN;
+	int16_t pen = x;
+	for (uint16_t i = 0; i < count; i++)
+	{
+		if (i > 0)
+			pen += gfxKern(pText[i - 1], pText[i]);
+		pGlyphs[i] = gfxGlyph(pText[i]);
+		readers[i] = {_pGFXFont->bitmap + pGlyphs[i]->bitmapOffset, 0, 0, 0};
+		left[i] = pen + pGlyphs[i]->xOffset;
+		pen += pGlyphs[i]->xAdvance;
+		if (pGlyphs[i]->width == 0 || pGlyphs[i]->height == 0)
+			continue;
+		x0 = std::min<int16_t>(x0, left[i]);
+		x1 = std::max<int16_t>(x1, left[i] + pGlyphs[i]->width - 1);
+		y0 = std::min<int16_t>(y0, baseline + pGlyphs[i]->yOffset);
+		y1 = std::max<int16_t>(y1, baseline + pGlyphs[i]->yOffset + pGlyphs[i]->height - 1);
+	}
+
+	if (bg == color)
+	{
+		// Transparent, horizontal runs of ink, half coverage or more
+		uint8_t levelHalf = ((1 << _pGFXFont->bpp) - 1) / 2;
+		for (uint16_t i = 0; i < count; i++)
+		{
+			const TFT_GFXglyph_t *pGlyph = pGlyphs[i];
+			uint8_t levels[TFT_GFX_GLYPH_WIDTH_MAX];
+			for (uint8_t row = 0; row < pGlyph->height; row++)
+			{
+				gfxReadRow(pGlyph, readers[i], row, levels);
+				int16_t runStart = -1;
+				for (uint16_t col = 0; col <= pGlyph->width; col++)
+				{
+					bool ink = col < pGlyph->width && levels[col] > levelHalf;
+					if (ink && runStart < 0)
+						runStart = col;
+					else if (!ink && runStart >= 0)
+					{
+						fillRectClip(left[i] + runStart, baseline + pGlyph->yOffset + row, col - runStart, 1, color);
+						runStart = -1;
+					}
+				}
+			}
+		}
+		return pen;
+	}
+
+	// Opaque, one window around the glyph boxes clipped to the screen
+	x0 = std::max<int16_t>(x0, 0);
+	y0 = std::max<int16_t>(y0, 0);
+	x1 = std::min<int16_t>(x1, _widthTFT - 1);
+	y1 = std::min<int16_t>(y1, _heightTFT - 1);
+	if (x0 > x1 || y0 > y1)
+		return pen;
+	uint16_t rowBuffer[2][TFT_TEXT_ROW_PIXELS];
+	const uint16_t *pRamp = gfxRamp(color, bg);
+	for (int16_t sliceX = x0; sliceX <= x1; sliceX += TFT_TEXT_ROW_PIXELS)
+	{
+		uint16_t w = std::min<int16_t>(x1 - sliceX + 1, TFT_TEXT_ROW_PIXELS);
+		if (sliceX > x0)
+		{
+			TFTDMAWait(); // row buffers are reused
+			for (uint16_t i = 0; i < count; i++)
+				readers[i] = {_pGFXFont->bitmap + pGlyphs[i]->bitmapOffset, 0, 0, 0};
+		}
+		TFTsetAddrWindow(sliceX, y0, sliceX + w - 1, y1);
+		for (int16_t row = y0; row <= y1; row++)
+		{
+			uint16_t *pRow = rowBuffer[row & 1];
+			std::fill(pRow, pRow + w, bg);
+			for (uint16_t i = 0; i < count; i++)
+			{
+				int16_t glyphRow = row - (baseline + pGlyphs[i]->yOffset);
+				if (glyphRow >= 0 && glyphRow < pGlyphs[i]->height)
+					gfxRasterRow(pGlyphs[i], readers[i], glyphRow, pRamp, pRow, left[i] - sliceX, w);
+			}
+			pushPixels16(pRow, w);
+		}
+	}
+	TFTDMAWait();
+	return pen;
+}
+
+/*!
+	@brief Draw text in the proportional font, wrapping to the left edge
+	@param x X coordinate of the pen
+	@param y Y coordinate of the top of the first text line
+	@param pText characters
+	@param length number of characters
+	@param color 565 16-bit color
+	@param bg background color, bg == color draws the ink only
+	@return
+		-# Display_Success=success
+		-# Display_CharFontASCIIRange=character not in the font
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::gfxText(int16_t x, int16_t y, const uint8_t *pText, size_t length, uint16_t color, uint16_t bg)
+{
+	size_t i = 0;
+	while (i < length && y < (int16_t)_heightTFT)
+	{
+		uint16_t run = gfxRunMeasure(x, pText + i, std::min<size_t>(length - i, 0xFFFF));
+		if (run > 0)
+		{
+			x = gfxRunDraw(x, y, pText + i, run, color, bg);
+			i += run;
+			continue;
+		}
+		uint8_t character = pText[i];
+		if (character == '\r')
+		{
+			i++;
+			continue;
+		}
+		if (character != '\n' && gfxGlyph(character) == nullptr)
+		{
+			printf("Error TFTdrawText 5C: Character = %u. Out of Font Range : %u <> %u\r\n", character, _pGFXFont->first, _pGFXFont->last);
+			return Display_CharFontASCIIRange;
+		}
+		if (character == '\n')
+			i++;
+		x = 0;
+		y += _pGFXFont->yAdvance;
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief Look up a glyph in the glyph cache, rasterise it on a miss
+	@param pColumns column data from fontGlyph
+	@param character ASCII character
+	@param color foreground 565 color
+	@param bg background 565 color
+	@param size text size
+	@return the glyph pixels in the cache arena, nullptr if the cache is off
+		or the glyph is larger than a slot
+	@note On a miss the least recently used slot is replaced.
+*/
+uint16_t *ST7789_TFT_graphics::glyphCacheFind(const uint8_t *pColumns, uint8_t character, uint16_t color, uint16_t bg, uint8_t size)
+{
+	if (_pGlyphArena == nullptr)
+		return nullptr;
+	uint32_t pixels = (uint32_t)(_CurrentFontWidth + 1) * size * _CurrentFontheight * size;
+	if (pixels > _glyphSlotPixels)
+		return nullptr;
+
+	_glyphClock++;
+	uint8_t victim = 0;
+	for (uint8_t i = 0; i < _glyphSlotCount; i++)
+	{
+		TFT_GlyphSlot_t &slot = _pGlyphSlots[i];
+		if (slot.lastUse != 0 && slot.character == character && slot.font == _FontNumber &&
+			slot.size == size && slot.color == color && slot.bg == bg)
+		{
+			slot.lastUse = _glyphClock;
+			return _pGlyphArena + i * _glyphSlotPixels;
+		}
+		if (slot.lastUse < _pGlyphSlots[victim].lastUse)
+			victim = i;
+	}
+
+	// Miss, the victim slot may still be going out by DMA
+	TFTDMAWait();
+	TFT_GlyphSlot_t &slot = _pGlyphSlots[victim];
+	slot.lastUse = _glyphClock;
+	slot.color = color;
+	slot.bg = bg;
+	slot.font = _FontNumber;
+	slot.character = character;
+	slot.size = size;
+	uint16_t *pGlyph = _pGlyphArena + victim * _glyphSlotPixels;
+	glyphRaster(pColumns, color, bg, size, pGlyph);
+	return pGlyph;
+}
+
+/*!
+	@brief Turn the fonts 1-6 glyph cache on or off
+	@param pArena RAM for rasterised RGB565 glyphs, nullptr to turn off
+	@param arenaSize size of pArena in pixels
+	@param maxSize largest text size cached 1-14, sets the slot size
+	@return
+		-# Display_Success=success
+		-# Display_BufferSize=arena smaller than one slot
+		-# Display_GenericError=maxSize out of range
+	@note The arena is split into equal slots of 9 * 8 * maxSize * maxSize
+		pixels, up to TFT_GLYPH_CACHE_SLOTS of them, and the slot table, 12
+		bytes a slot, is kept after them at its end. Each slot holds one
+		glyph for a font, character, colors and size, the least recently
+		drawn glyph is replaced on a miss. Cached glyphs go out as one window
+		each, with DMA if enabled. Transparent text (bg == color) and glyphs
+		clipped by the screen edge are drawn uncached. On an error the cache
+		is left off.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTsetGlyphCache(uint16_t *pArena, uint32_t arenaSize, uint8_t maxSize)
+{
+	TFTDMAWait();
+	_pGlyphArena = nullptr;
+	_glyphSlotCount = 0;
+	if (pArena == nullptr)
+		return Display_Success;
+	if (maxSize == 0 || maxSize >= 15)
+	{
+		printf("Error TFTsetGlyphCache 2: Max size %u must be 1-14\r\n", maxSize);
+		return Display_GenericError;
+	}
+	_glyphSlotPixels = (uint32_t)(TFTFont_width_8 + 1) * TFTFont_height_8 * maxSize * maxSize;
+	// Each slot costs its pixels and a table entry, less the table alignment padding
+	uint32_t slotBytes = _glyphSlotPixels * sizeof(uint16_t) + sizeof(TFT_GlyphSlot_t);
+	uint32_t arenaBytes = arenaSize * sizeof(uint16_t);
+	uint32_t slots = 0;
+	if (arenaBytes >= alignof(TFT_GlyphSlot_t))
+		slots = std::min<uint32_t>((arenaBytes - (alignof(TFT_GlyphSlot_t) - 1)) / slotBytes, TFT_GLYPH_CACHE_SLOTS);
+	if (slots == 0)
+	{
+		printf("Error TFTsetGlyphCache 1: Arena size %lu is less than one slot %lu\r\n", (unsigned long)arenaSize, (unsigned long)((slotBytes + alignof(TFT_GlyphSlot_t)) / sizeof(uint16_t)));
+		return Display_BufferSize;
+	}
+	uintptr_t table = (uintptr_t)(pArena + slots * _glyphSlotPixels);
+	table = (table + alignof(TFT_GlyphSlot_t) - 1) & ~(uintptr_t)(alignof(TFT_GlyphSlot_t) - 1);
+	_pGlyphSlots = (TFT_GlyphSlot_t *)table;
+	_pGlyphArena = pArena;
+	_glyphSlotCount = slots;
+	TFTglyphCacheClear();
+	return Display_Success;
+}
+
+/*!
+	@brief Empty the glyph cache, the arena is kept
+*/
+void ST7789_TFT_graphics::TFTglyphCacheClear(void)
+{
+	for (uint8_t i = 0; i < _glyphSlotCount; i++)
+		_pGlyphSlots[i].lastUse = 0;
+	_glyphClock = 0;
+}
+
+/*!
+	@brief turn on or off screen wrap of the text (fonts 1-6)
+	@param w TRUE on
+*/
+void ST7789_TFT_graphics ::TFTsetTextWrap(bool w)
+{
+	_wrap = w;
+}
+
+/*!
+	@brief Writes text string on the TFT
+	@param x X coordinate
+	@param y Y coordinate
+	@param pText pointer to string/array
+	@param color 565 16-bit
+	@param bg background color
+	@param size 1-x
+	@return
+		-# Display_Success=success
+		-# Display_WrongFont=wrong font, a proportional font is drawn with the overload without size
+		-# Display_CharScreenBounds=Co-ordinates out of bounds
+		-# Display_CharArrayNullptr=Invalid pointer object
+		-# if TFTdrawChar method error upstream it return that error code.
+	@note for font #1-6 only
+*/
+Display_Return_Codes_e ST7789_TFT_graphics ::TFTdrawText(uint16_t x, uint16_t y, char *pText, uint16_t color, uint16_t bg, uint8_t size)
+{
+
+	// Check if correct font
+	if (_pGFXFont != nullptr)
+	{
+		printf("Error TFTdrawText 6: Proportional font set, use TFTdrawText without size\r\n");
+		return Display_WrongFont;
+	}
+	if (_FontNumber >= TFTFont_Bignum)
+	{
+		printf("Error TFTdrawText 2: Wrong font number selected, must be 1-6\r\n");
+		return Display_WrongFont;
+	}
+	// Check for null pointer
+	if (pText == nullptr)
+	{
+		printf("Error TFTdrawText 3: String array is not valid pointer object\r\n");
+		return Display_CharArrayNullptr;
+	}
+	// Out of screen bounds
+	if ((x >= _widthTFT) || (y >= _heightTFT))
+	{
+		printf("Error TFTdrawText 4: Out of screen bounds\r\n");
+		return Display_CharScreenBounds;
+	}
+	uint16_t cursorX = x;
+	uint16_t cursorY = y;
+	size_t length = strlen(pText);
+	Display_Return_Codes_e  errorCode;
+	while (length > 0)
+	{
+		if (_wrap && ((cursorX + size * _CurrentFontWidth) > _widthTFT))
+		{
+			cursorX = 0;
+			cursorY = cursorY + size * 7 + 3;
+			if (cursorY > _heightTFT)
+				cursorY = _heightTFT;
+		}
+		// Characters up to the end of the line go as one window
+		uint16_t run = textRunMeasure(cursorX, cursorY, (const uint8_t *)pText, std::min<size_t>(length, 0xFFFF), color, bg, size, _widthTFT);
+		if (run > 0)
+		{
+			textRunDraw(cursorX, cursorY, (const uint8_t *)pText, run, color, bg, size);
+			cursorX = cursorX + run * size * (_CurrentFontWidth + 1);
+			pText += run;
+			length -= run;
+			continue;
+		}
+		errorCode = TFTdrawChar(cursorX, cursorY, *pText, color, bg, size);
+		if ( errorCode != Display_Success)
+		{
+			printf("Error TFTdrawText 5: Method TFTdrawChar failed\r\n");
+			return errorCode;
+		}
+		cursorX = cursorX + size * (_CurrentFontWidth + 1);
+
+		if (cursorX > _widthTFT)
+			cursorX = _widthTFT;
+		pText++;
+		length--;
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief: called by the print class after it converts the data to a character
+	@param character character
+*/
+size_t ST7789_TFT_graphics ::write(uint8_t character)
+{
+	if (_pGFXFont != nullptr)
+		return write(&character, 1);
+	if (_FontNumber < TFTFont_Bignum)
 	{
 		switch (character)
 		{
 		case '\n':
-			_cursorY += _textSize * _CurrentFontheight;
-			_cursorX = 0;
+			textNewLine(_textSize * _CurrentFontheight);
 			break;
 		case '\r': /* skip */
 			break;
@@ -685,10 +1569,7 @@ size_t ST7789_TFT_graphics ::write(uint8_t character)
 			}
 			_cursorX += _textSize * (_CurrentFontWidth + 1);
 			if (_wrap && (_cursorX > (_widthTFT - _textSize * (_CurrentFontWidth + 1))))
-			{
-				_cursorY += _textSize * _CurrentFontheight;
-				_cursorX = 0;
-			}
+				textNewLine(_textSize * _CurrentFontheight);
 			break;
 		}
 	}
@@ -697,8 +1578,7 @@ size_t ST7789_TFT_graphics ::write(uint8_t character)
 		switch (character)
 		{
 		case '\n':
-			_cursorY += _CurrentFontheight;
-			_cursorX = 0;
+			textNewLine(_CurrentFontheight);
 			break;
 		case '\r': /* skip */
 			break;
@@ -711,22 +1591,140 @@ size_t ST7789_TFT_graphics ::write(uint8_t character)
 			}
 			_cursorX += (_CurrentFontWidth);
 			if (_wrap && (_cursorX > (_widthTFT - (_CurrentFontWidth + 1))))
-			{
-				_cursorY += _CurrentFontheight;
-				_cursorX = 0;
-			}
+				textNewLine(_CurrentFontheight);
 			break;
 		} // end of switch
 	}	  // end of else
 	return 1;
 }
 
+/*!
+	@brief: called by the print class with a converted string or number
+	@param pBuffer characters
+	@param size number of characters
+	@return number of characters written
+	@note Characters up to the next line break or wrap are sent as one
+		window, others go through write(uint8_t).
+*/
+size_t ST7789_TFT_graphics ::write(const uint8_t *pBuffer, size_t size)
+{
+	if (_pGFXFont != nullptr)
+	{
+		size_t n = 0;
+		while (n < size)
+		{
+			uint16_t run = gfxRunMeasure(_cursorX, pBuffer + n, std::min<size_t>(size - n, 0xFFFF));
+			if (run > 0)
+			{
+				_cursorX = gfxRunDraw(_cursorX, _cursorY, pBuffer + n, run, _textcolor, _textbgcolor);
+				n += run;
+				continue;
+			}
+			// Line break, wrap before a character or a character not in the font,
+			// '\r' is skipped like the other text paths even if the font has it
+			uint8_t character = pBuffer[n];
+			if (character == '\r')
+			{
+				n++;
+				continue;
+			}
+			if (character == '\n' || gfxGlyph(character) != nullptr)
+				textNewLine(_pGFXFont->yAdvance);
+			if (character == '\n' || gfxGlyph(character) == nullptr)
+				n++;
+		}
+		return n;
+	}
+	bool large = (_FontNumber >= TFTFont_Bignum);
+	uint8_t textSize = large ? 1 : _textSize;
+	uint16_t cellWidth = large ? _CurrentFontWidth : (_CurrentFontWidth + 1) * textSize;
+	// write(uint8_t) wraps fonts 7-12 one column early
+	uint16_t right = (_wrap && large) ? _widthTFT - 1 : _widthTFT;
+	size_t n = 0;
+	while (n < size)
+	{
+		uint16_t run = 0;
+		if (_cursorX >= 0 && _cursorY >= 0)
+			run = textRunMeasure(_cursorX, _cursorY, pBuffer + n, std::min<size_t>(size - n, 0xFFFF), _textcolor, _textbgcolor, textSize, right);
+		if (run == 0)
+		{
+			if (write(pBuffer[n]) == 0)
+				break;
+			n++;
+			continue;
+		}
+		textRunDraw(_cursorX, _cursorY, pBuffer + n, run, _textcolor, _textbgcolor, textSize);
+		_cursorX += run * cellWidth;
+		n += run;
+		if (_wrap && (_cursorX + cellWidth + (large ? 1 : 0)) > _widthTFT)
+			textNewLine(textLineHeight());
+	}
+	return n;
+}
+
+/*!
+	@brief Move the print cursor to the start of the next text line
+	@param lineHeight height of the current font in pixels
+	@note In console mode the line height set at TFTconsoleBegin is used and
+		the console scrolls when the cursor is on its last line.
+*/
+void ST7789_TFT_graphics::textNewLine(uint8_t lineHeight)
+{
+	_cursorX = 0;
+	if (_consoleOn == false)
+	{
+		_cursorY += lineHeight;
+		return;
+	}
+	if (_consoleLine + 1 < _consoleHeight / _consoleLineHeight)
+	{
+		_consoleLine++;
+		_cursorY = _consoleTop + (_consoleLine * _consoleLineHeight + _consoleScroll) % _consoleHeight;
+		return;
+	}
+	// On the last line, the top line's rows become the new bottom line.
+	// Clear them and move the hardware scroll start down one line.
+	_cursorY = _consoleTop + _consoleScroll;
+	fillRectClip(0, _cursorY, _widthTFT, _consoleLineHeight, _textbgcolor);
+	_consoleScroll = (_consoleScroll + _consoleLineHeight) % _consoleHeight;
+	scrollAreaMove(_consoleTFA, _consoleHeight, _consoleScroll, _consoleReverse);
+}
+
+/*!
+	@brief Send the hardware scroll start address for a scroll area
+	@param topFixed frame memory line the scroll area starts at
+	@param length scroll area size in lines
+	@param scroll lines the content has moved towards the area start on screen
+	@param reverse true if frame memory lines run the opposite way to the screen co-ordinate
+*/
+void ST7789_TFT_graphics::scrollAreaMove(uint16_t topFixed, uint16_t length, uint16_t scroll, bool reverse)
+{
+	uint16_t scrollStart = topFixed + (reverse ? (length - scroll) % length : scroll);
+	const uint16_t seqScroll[] = {
+		ST7789_VSCRSADD,
+		uint16_t(TFT_SEQ_DATA | (scrollStart >> 8)), uint16_t(TFT_SEQ_DATA | (scrollStart & 0xFF))
+	};
+	writeCommandSequence(seqScroll, sizeof(seqScroll) / sizeof(seqScroll[0]));
+}
+
+/*!
+	@brief Get the height of a text line in the current font and text size
+	@return line height in pixels
+*/
+uint8_t ST7789_TFT_graphics::textLineHeight(void)
+{
+	if (_pGFXFont != nullptr)
+		return _pGFXFont->yAdvance;
+	return (_FontNumber < TFTFont_Bignum) ? _textSize * _CurrentFontheight : _CurrentFontheight;
+}
+
 /*!
 	@brief   Set the font type
 	@param FontNumber 1-12 enum OLED_FONT_TYPE_e
 */
 void ST7789_TFT_graphics ::TFTFontNum(TFT_Font_Type_e FontNumber)
 {
+	_pGFXFont = nullptr;
 	_FontNumber = FontNumber;
 	switch (_FontNumber)
 	{
@@ -916,34 +1914,39 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap(int16_t x, int16_t y,
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
-	// Buffer for one row of pixels (16-bit per pixel split into bytes)
-	uint8_t rowBuffer[w * 2];
+	// Two buffers for a row of pixels, native 16-bit colors
+	// One is built while the other is sent by DMA, a wider row goes as slices
+	uint16_t rowBuffer[2][TFT_ROW_PIXELS_MAX];
+	uint8_t half = 0;
 
+	// One address window for the whole bitmap, rows streamed into it
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
 	// Draw row by row
 	for (int16_t j = 0; j < h; j++)
 	{
-		// Process one row of pixels
-		for (int16_t i = 0; i < w; i++)
+		for (int16_t slice = 0; slice < w; slice += TFT_ROW_PIXELS_MAX)
 		{
-			 // Load the next byte of bitmap data if necessary
-			if (i & 7)
-				byte <<= 1; // Shift left to get the next bit
-			else
-				byte = pBmp[j * byteWidth + i / 8]; // Load the next byte of bitmap data
-			// Determine the color for the current pixel
-			mycolor = (byte & 0x80) ? color : bgcolor;
-			// Correct order: High byte first, low byte second
-			rowBuffer[2 * i] = mycolor >> 8;      // High byte
-			rowBuffer[2 * i + 1] = mycolor & 0xFF; // Low byte
-		}
-
-		// Set the address window for the current row
-		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
+			uint16_t *pRow = rowBuffer[half];
+			int16_t count = std::min<int16_t>(w - slice, TFT_ROW_PIXELS_MAX);
+			half ^= 1;
+			// Process one slice of pixels, slices start on a byte
+			for (int16_t i = slice; i < slice + count; i++)
+			{
+				 // Load the next byte of bitmap data if necessary
+				if (i & 7)
+					byte <<= 1; // Shift left to get the next bit
+				else
+					byte = pBmp[j * byteWidth + i / 8]; // Load the next byte of bitmap data
+				// Determine the color for the current pixel
+				mycolor = (byte & 0x80) ? color : bgcolor;
+				pRow[i - slice] = mycolor;
+			}
 
-		// Write the row to the display
-		spiWriteDataBuffer(rowBuffer, w * 2);
+			// Write the slice to the display
+			pushPixels16(pRow, count);
+		}
 	}
-
+	TFTDMAWait(); // rowBuffer is on the stack
 	return Display_Success;
 }
 
@@ -965,6 +1968,7 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap24Data(uint16_t x, uin
 {
 	uint16_t i, j;
 	uint16_t color, red, green, blue;
+	uint16_t bmpWidth = w; // row length of the data array, before clipping
 
 	// 1. Check for null pointer
 	if (pBmp == nullptr)
@@ -984,29 +1988,37 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap24Data(uint16_t x, uin
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
-	// Buffer for one row of pixels (16-bit per pixel split into bytes)
-	uint8_t rowBuffer[w * 2];
+	// Two buffers for a row of pixels, native 16-bit colors
+	// One is converted while the other is sent by DMA, a wider row goes as slices
+	uint16_t rowBuffer[2][TFT_ROW_PIXELS_MAX];
+	uint8_t half = 0;
 
+	// One address window for the whole bitmap, rows streamed into it
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
 	// Draw the bitmap row by row
 	for (j = 0; j < h; j++)
 	{
-		for (i = 0; i < w; i++)
+		for (uint16_t slice = 0; slice < w; slice += TFT_ROW_PIXELS_MAX)
 		{
-			// Extract RGB values from 24-bit color data
-			red = *pBmp++;
-			green = *pBmp++;
-			blue = *pBmp++;
-			// Convert to 16-bit RGB565 format
-			color = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
-			// Store high and low bytes of the color in the row buffer
-			rowBuffer[2 * i] = color >> 8;      // High byte
-			rowBuffer[2 * i + 1] = color & 0xFF; // Low byte
+			uint16_t *pRow = rowBuffer[half];
+			uint16_t count = std::min<uint16_t>(w - slice, TFT_ROW_PIXELS_MAX);
+			half ^= 1;
+			for (i = 0; i < count; i++)
+			{
+				// Extract RGB values from 24-bit color data
+				red = *pBmp++;
+				green = *pBmp++;
+				blue = *pBmp++;
+				// Convert to 16-bit RGB565 format
+				color = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+				pRow[i] = color;
+			}
+			// Write the slice to the display
+			pushPixels16(pRow, count);
 		}
-		// Set the address window for the current row
-		TFTsetAddrWindow(x, y + j, x + w - 1, y + j);
-		// Write the row to the display
-		spiWriteDataBuffer(rowBuffer, w * 2);
+		pBmp += (bmpWidth - w) * 3; // skip clipped pixels of this row
 	}
+	TFTDMAWait(); // rowBuffer is on the stack
 	return Display_Success;
 }
 
@@ -1021,10 +2033,12 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap24Data(uint16_t x, uin
 		-# Display_Success=success
 		-# Display_BitmapNullptr=invalid pointer object
 		-# Display_BitmapScreenBounds=Co-ordinates out of bounds
+	@note With DMA enabled the last row may still be sending on return,
+		  call TFTDMAWait before modifying the data array.
 */
 Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap16Data(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h)
 {
-	uint16_t j = 0;
+	uint16_t bmpWidth = w; // row length of the data array, before clipping
 
 	// 1. Check for null pointer
 	if (pBmp == nullptr)
@@ -1044,37 +2058,90 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap16Data(uint16_t x, uin
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
-	// Process bitmap data row-by-row
-	for (j = 0; j < h; j++)
+	// One address window for the whole bitmap
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	if (w == bmpWidth)
 	{
-		TFTsetAddrWindow(x, y + j, x + w - 1, y + j); // Set the window for the current row
-		spiWriteDataBuffer(pBmp, w * sizeof(uint16_t)); // Write one row of pixel data
-		pBmp += w * 2; // Move to the next row in the bitmap
+		// Not clipped, rows are contiguous so send in one burst
+		pushPixelBytes(pBmp, (uint32_t)w * h * sizeof(uint16_t));
+		return Display_Success;
 	}
-
+	// Clipped, send the visible part of each row
+	pushPixelRows(pBmp, w, h, (uint32_t)bmpWidth * sizeof(uint16_t), true);
 	return Display_Success;
 }
 
 /*!
-	@brief writes a char (c) on the TFT
+	@brief: Draws a 16-bit color bitmap to the screen from a native uint16_t array
 	@param x X coordinate
 	@param y Y coordinate
-	@param character The ASCII character
-	@param color 565 16-bit
-	@param bg background color
+	@param pBmp pointer to array of 565 16-bit colors, one per pixel
+	@param w width of the bitmap in pixels
+	@param h height of the bitmap in pixels
 	@return
 		-# Display_Success=success
-		-# Display_WrongFont =wrong font
+		-# Display_BitmapNullptr=invalid pointer object
+		-# Display_BitmapScreenBounds=Co-ordinates out of bounds
+	@note Sent with 16-bit SPI frames, no byte swapping. With DMA enabled the
+		  last row may still be sending on return, call TFTDMAWait before
+		  modifying the data array.
+*/
+Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawBitmap16Buffer(uint16_t x, uint16_t y, const uint16_t *pBmp, uint16_t w, uint16_t h)
+{
+	uint16_t bmpWidth = w; // row length of the data array, before clipping
+
+	// 1. Check for null pointer
+	if (pBmp == nullptr)
+	{
+		printf("Error TFTdrawBitmap16Buffer 1: Bitmap array is nullptr\r\n");
+		return Display_BitmapNullptr;
+	}
+	// Check bounds
+	if ((x >= _widthTFT) || (y >= _heightTFT))
+	{
+		printf("Error TFTdrawBitmap16Buffer 2: Out of screen bounds\r\n");
+		return Display_BitmapScreenBounds;
+	}
+	if ((x + w - 1) >= _widthTFT)
+		w = _widthTFT - x;
+	if ((y + h - 1) >= _heightTFT)
+		h = _heightTFT - y;
+
+	// One address window for the whole bitmap
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	if (w == bmpWidth)
+	{
+		// Not clipped, rows are contiguous so send in one burst
+		pushPixels16(pBmp, (uint32_t)w * h);
+		return Display_Success;
+	}
+	pushPixelRows(pBmp, w, h, (uint32_t)bmpWidth * sizeof(uint16_t), false);
+	return Display_Success;
+}
+
+/*!
+	@brief writes a char (c) on the TFT
+	@param x X coordinate
+	@param y Y coordinate
+	@param character The ASCII character
+	@param color 565 16-bit
+	@param bg background color
+	@return
+		-# Display_Success=success
+		-# Display_WrongFont =wrong font
 		-# Display_CharScreenBounds=Co-ordinates out of bounds,
 		-# Display_CharFontASCIIRange=ASCII character not in fonts range,
 		-# Display_FontNotEnabled=Font selected but not enabled in _font.hpp
-	@note for font 7-12 only
+	@note for font 7-12 only. A glyph fully on screen is sent as one window,
+		built a pixel row at a time.
 */
 Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawChar(uint16_t x, uint16_t y, uint8_t character, uint16_t color, uint16_t bg)
 {
-	uint8_t FontSizeMod = 0;
-	uint8_t i, j;
-	uint8_t ctemp = 0, y0 = y;
+	uint16_t i;
+	uint8_t j;
+	uint8_t ctemp = 0;
+	uint8_t row = 0, runStart = 0; // pixel row in the current column, start of the current run
+	bool runOn = false;
 
 	// 1. Check for screen out of bounds
 	if ((x >= _widthTFT) ||					 // Clip right
@@ -1086,6 +2153,18 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawChar(uint16_t x, uint16_t y
 		return Display_CharScreenBounds;
 	}
 
+	// Proportional font, y is the top of the text line
+	if (_pGFXFont != nullptr)
+	{
+		if (gfxGlyph(character) == nullptr)
+		{
+			printf("Error TFTdrawChar 4C: Character = %u. Out of Font Range : %u <> %u\r\n", character, _pGFXFont->first, _pGFXFont->last);
+			return Display_CharFontASCIIRange;
+		}
+		gfxRunDraw(x, y, &character, 1, color, bg);
+		return Display_Success;
+	}
+
 	// 2. Check for character out of font range bounds
 	if (character < _CurrentFontoffset || character >= (_CurrentFontLength + _CurrentFontoffset))
 	{
@@ -1093,77 +2172,53 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawChar(uint16_t x, uint16_t y
 		return Display_CharFontASCIIRange;
 	}
 
-	// 3. Check for correct font and set FontSizeMod for fonts 7-12
-	switch (_FontNumber)
+	// 3. Check for correct font
+	if (_FontNumber < TFTFont_Bignum)
 	{
-	case TFTFont_Bignum:
-	case TFTFont_Mednum:
-	case TFTFont_ArialRound:
-	case TFTFont_ArialBold:
-		FontSizeMod = 2;
-		break;
-	case TFTFont_Mia:
-	case TFTFont_Dedica:
-		FontSizeMod = 1;
-		break;
-	default:
 		printf("Error TFTdrawChar 5B: Wrong font selected, Font must be > 7 : %u\r\n", _FontNumber);
 		return Display_WrongFont;
-		break;
+	}
+	const uint8_t *pColumns = fontGlyph(character);
+	if (pColumns == nullptr)
+	{
+		printf("Error TFTdrawChar 6B: Is the font you selected enabled in _font.hpp? : %u\r\n", _FontNumber);
+		return Display_FontNotEnabled;
 	}
 
-	for (i = 0; i < _CurrentFontheight * FontSizeMod; i++)
+	// 4. Glyph fully on screen, sent as one window a row at a time
+	if ((x + _CurrentFontWidth) <= _widthTFT && (y + _CurrentFontheight) <= _heightTFT)
 	{
-		switch (_FontNumber)
-		{
-		case TFTFont_Bignum:
-			ctemp = pFontBigNum16x32ptr[character - _CurrentFontoffset][i];
-			break;
-		case TFTFont_Mednum:
-			ctemp = pFontMedNum16x16ptr[character - _CurrentFontoffset][i];
-			break;
-#ifdef _TFT_OPTIONAL_FONT_9
-		case TFTFont_ArialRound:
-			ctemp = pFontArial16x24ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-#ifdef _TFT_OPTIONAL_FONT_10
-		case TFTFont_ArialBold:
-			ctemp = pFontArial16x16ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-#ifdef _TFT_OPTIONAL_FONT_11
-		case TFTFont_Mia:
-			ctemp = pFontMia8x16ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-#ifdef _TFT_OPTIONAL_FONT_12
-		case TFTFont_Dedica:
-			ctemp = pFontDedica6x12ptr[character - _CurrentFontoffset][i];
-			break;
-#endif
-		default:
-			printf("Error TFTdrawChar 6B: Is the font you selected enabled in _font.hpp? : %u\r\n", _FontNumber);
-			return Display_FontNotEnabled;
-			break;
-		}
+		textRunDraw(x, y, &character, 1, color, bg, 1);
+		return Display_Success;
+	}
+
+	// 5. Clipped by the screen edge, columns drawn as runs
+	uint8_t columnBytes = (_CurrentFontheight + 7) / 8;
+	for (i = 0; i < _CurrentFontWidth * columnBytes; i++)
+	{
+		ctemp = pColumns[i];
 
+		// Column drawn as vertical runs, a run may continue into the next byte
 		for (j = 0; j < 8; j++)
 		{
-			if (ctemp & 0x80)
+			bool bitOn = ctemp & 0x80;
+			if (row == 0)
 			{
-				TFTdrawPixel(x, y, color);
+				runOn = bitOn;
+				runStart = 0;
 			}
-			else
+			else if (bitOn != runOn)
 			{
-				TFTdrawPixel(x, y, bg);
+				fillRectClip(x, y + runStart, 1, row - runStart, runOn ? color : bg);
+				runOn = bitOn;
+				runStart = row;
 			}
-
 			ctemp <<= 1;
-			y++;
-			if ((y - y0) == _CurrentFontheight)
+			row++;
+			if (row == _CurrentFontheight)
 			{
-				y = y0;
+				fillRectClip(x, y + runStart, 1, row - runStart, runOn ? color : bg);
+				row = 0;
 				x++;
 				break;
 			}
@@ -1190,7 +2245,7 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawChar(uint16_t x, uint16_t y
 Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawText(uint16_t x, uint16_t y, char *pText, uint16_t color, uint16_t bg)
 {
 	// Check for correct font
-	if (_FontNumber < TFTFont_Bignum)
+	if (_FontNumber < TFTFont_Bignum && _pGFXFont == nullptr)
 	{
 		printf("Error TFTdrawText 2B: Wrong font selected, must be 7 to 12 \r\n");
 		return Display_WrongFont;
@@ -1207,8 +2262,11 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawText(uint16_t x, uint16_t y
 		printf("Error TFTdrawText 4B: Out of screen bounds\r\n");
 		return Display_CharScreenBounds;
 	}
+	size_t length = strlen(pText);
+	if (_pGFXFont != nullptr)
+		return gfxText(x, y, (const uint8_t *)pText, length, color, bg);
 	Display_Return_Codes_e  errorCode;
-	while (*pText != '\0')
+	while (length > 0)
 	{
 		if (x > (_widthTFT - _CurrentFontWidth))
 		{
@@ -1219,6 +2277,16 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawText(uint16_t x, uint16_t y
 				y = x = 0;
 			}
 		}
+		// Characters up to the end of the line go as one window
+		uint16_t run = textRunMeasure(x, y, (const uint8_t *)pText, std::min<size_t>(length, 0xFFFF), color, bg, 1, _widthTFT);
+		if (run > 0)
+		{
+			textRunDraw(x, y, (const uint8_t *)pText, run, color, bg, 1);
+			x += run * _CurrentFontWidth;
+			pText += run;
+			length -= run;
+			continue;
+		}
 		errorCode = TFTdrawChar(x, y, *pText, color, bg);
 		if ( errorCode != Display_Success)
 		{
@@ -1227,6 +2295,7 @@ Display_Return_Codes_e  ST7789_TFT_graphics ::TFTdrawText(uint16_t x, uint16_t y
 		}
 		x += _CurrentFontWidth;
 		pText++;
+		length--;
 	}
 	return Display_Success;
 }
@@ -1252,22 +2321,222 @@ uint16_t ST7789_TFT_graphics::Color565(uint16_t r, uint16_t g, uint16_t b)
  */
 void ST7789_TFT_graphics ::pushColor(uint16_t color)
 {
-	uint8_t hi, lo;
-	hi = color >> 8;
-	lo = color;
+	pushColorRun(color, 1);
+}
+
+/*!
+	@brief Stream one color into the current address window count times
+	@param color 565 16-bit color
+	@param count number of pixels
+	@note With DMA the color is read from one fixed address with read increment off,
+		  using 16-bit frames, so no pixel buffer is needed and the fill
+		  continues in the background. Short runs are sent directly.
+*/
+void ST7789_TFT_graphics::pushColorRun(uint16_t color, uint32_t count)
+{
+	if (frameBufferOn())
+	{
+		frameBufferWrite(nullptr, color, count);
+		return;
+	}
+	if (_clipStream == true)
+	{
+		clipStream(count);
+		if (count == 0)
+			return;
+	}
+	if (_pixel12 == true)
+	{
+		pushPixels12(nullptr, color, count);
+		return;
+	}
+	TFTDMAWait();
+	if (_pioSPI == true)
+		pioSetMode(TFT_PIO_MODE_PIXEL16);
+	else
+		spiSetFrameSize(16);
+	if (_dmaChannel >= 0 && count >= 16)
+	{
+		_dmaFillColor = color;
+		if (_pioSPI == false)
+		{
+			TFT_DC_SetHigh;
+			TFT_CS_SetLow;
+		}
+		dmaStart(&_dmaFillColor, count, DMA_SIZE_16, false);
+		return;
+	}
+	if (_pioSPI == true)
+	{
+		while (count--)
+			pio_sm_put_blocking(_pPIO, _pioSM, (uint32_t)color << 16);
+		return;
+	}
 	TFT_DC_SetHigh;
 	TFT_CS_SetLow;
-	spiWrite(hi);
-	spiWrite(lo);
+	if (_hardwareSPI == false)
+	{
+		while (count--)
+		{
+			spiWriteSoftware(color >> 8);
+			spiWriteSoftware(color & 0xFF);
+		}
+	}
+	else
+	{
+		// Small repeating chunk, so several pixels are sent per call
+		uint16_t chunk[16];
+		for (uint8_t i = 0; i < 16; i++)
+			chunk[i] = color;
+		while (count > 0)
+		{
+			uint32_t pixels = (count > 16) ? 16 : count;
+			spi_write16_blocking(_pspiInterface, chunk, pixels);
+			count -= pixels;
+		}
+	}
 	TFT_CS_SetHigh;
 }
 
+/*!
+	@brief Stream an array of native 16-bit colors into the current address window
+	@param pixels 565 16-bit colors, must stay valid until the transfer completes
+	@param count number of pixels
+	@note Hardware and PIO SPI use 16-bit frames so no byte swapping is needed.
+		  With DMA the data may still be sending on return, call TFTDMAWait
+		  before reusing the array.
+*/
+void ST7789_TFT_graphics::pushPixels16(const uint16_t *pixels, uint32_t count)
+{
+	if (frameBufferOn())
+	{
+		frameBufferWrite(pixels, 0, count);
+		return;
+	}
+	if (_clipStream == true)
+	{
+		pixels += clipStream(count);
+		if (count == 0)
+			return;
+	}
+	if (_pixel12 == true)
+	{
+		pushPixels12(pixels, 0, count);
+		return;
+	}
+	TFTDMAWait();
+	if (_pioSPI == true)
+	{
+		pioSetMode(TFT_PIO_MODE_PIXEL16);
+		if (_dmaChannel >= 0 && count >= 16)
+		{
+			dmaStart(pixels, count, DMA_SIZE_16, true);
+			return;
+		}
+		while (count--)
+			pio_sm_put_blocking(_pPIO, _pioSM, (uint32_t)*pixels++ << 16);
+		return;
+	}
+	spiSetFrameSize(16);
+	TFT_DC_SetHigh;
+	TFT_CS_SetLow;
+	if (_hardwareSPI == false)
+	{
+		while (count--)
+		{
+			spiWriteSoftware(*pixels >> 8);
+			spiWriteSoftware(*pixels++ & 0xFF);
+		}
+	}
+	else if (_dmaChannel >= 0 && count >= 16)
+	{
+		dmaStart(pixels, count, DMA_SIZE_16, true);
+		return;
+	}
+	else
+	{
+		spi_write16_blocking(_pspiInterface, pixels, count);
+	}
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief Set Hardware SPI frame size
+	@param bits 16 for pixel data, 8 for commands, parameters and byte buffers
+	@note SPI must be idle, only changed when different from the current size
+*/
+void ST7789_TFT_graphics::spiSetFrameSize(uint8_t bits)
+{
+	if (_hardwareSPI == false || bits == _spiFrameBits)
+		return;
+	spi_set_format(_pspiInterface, bits, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+	_spiFrameBits = bits;
+}
+
+/*!
+	@brief Switch the PIO state machine between its command and pixel programs
+	@param mode TFT_PIO_MODE_CMD, TFT_PIO_MODE_PIXEL8 or TFT_PIO_MODE_PIXEL16
+	@note Waits for the state machine to finish shifting out before switching.
+		  Pixel modes drive DC high once, then autopull 8 or 16 bits per FIFO word.
+*/
+void ST7789_TFT_graphics::pioSetMode(uint8_t mode)
+{
+	if (mode == _pioMode)
+		return;
+	if (_pioMode != TFT_PIO_MODE_NONE)
+		pioWaitIdle();
+	pio_sm_config pioConfig;
+	uint8_t offset;
+	if (mode == TFT_PIO_MODE_CMD)
+	{
+		offset = _pioOffsetCmd;
+		pioConfig = st7789_tft_cmd_program_get_default_config(offset);
+	}
+	else
+	{
+		offset = _pioOffsetPixel;
+		pioConfig = st7789_tft_pixel_program_get_default_config(offset);
+	}
+	sm_config_set_sideset_pins(&pioConfig, _TFT_SCLK);
+	sm_config_set_out_pins(&pioConfig, _TFT_SDATA, 1);
+	sm_config_set_set_pins(&pioConfig, _TFT_DC, 1);
+	sm_config_set_fifo_join(&pioConfig, PIO_FIFO_JOIN_TX);
+	sm_config_set_clkdiv(&pioConfig, _pioClockDiv);
+	// Shift left MSB first, the command program pulls explicitly
+	sm_config_set_out_shift(&pioConfig, false, mode != TFT_PIO_MODE_CMD, (mode == TFT_PIO_MODE_CMD) ? 32 : mode);
+	pio_sm_init(_pPIO, _pioSM, offset, &pioConfig);
+	if (mode != TFT_PIO_MODE_CMD)
+		pio_sm_exec(_pPIO, _pioSM, pio_encode_set(pio_pins, 1)); // DC high for pixel data
+	pio_sm_set_enabled(_pPIO, _pioSM, true);
+	_pioMode = mode;
+}
+
+/*!
+	@brief Wait for the PIO state machine to shift out all queued data
+*/
+void ST7789_TFT_graphics::pioWaitIdle(void)
+{
+	uint32_t stallMask = 1u << (PIO_FDEBUG_TXSTALL_LSB + _pioSM);
+	_pPIO->fdebug = stallMask; // write 1 to clear, set again once stalled on empty FIFO
+	while ((_pPIO->fdebug & stallMask) == 0)
+		tight_loop_contents();
+}
+
 /*!
 	@brief : Write an SPI command to TFT
 	@param command byte to send
 */
 void ST7789_TFT_graphics::writeCommand(uint8_t command)
 {
+	pixel12Flush();
+	TFTDMAWait();
+	if (_pioSPI == true)
+	{
+		pioSetMode(TFT_PIO_MODE_CMD);
+		pio_sm_put_blocking(_pPIO, _pioSM, (uint32_t)command << 23);
+		return;
+	}
+	spiSetFrameSize(8);
 	TFT_DC_SetLow;
 	TFT_CS_SetLow;
 	spiWrite(command);
@@ -1280,12 +2549,55 @@ void ST7789_TFT_graphics::writeCommand(uint8_t command)
 */
 void ST7789_TFT_graphics ::writeData(uint8_t dataByte)
 {
+	TFTDMAWait();
+	if (_pioSPI == true)
+	{
+		pioSetMode(TFT_PIO_MODE_CMD);
+		pio_sm_put_blocking(_pPIO, _pioSM, (1u << 31) | ((uint32_t)dataByte << 23));
+		return;
+	}
+	spiSetFrameSize(8);
 	TFT_DC_SetHigh;
 	TFT_CS_SetLow;
 	spiWrite(dataByte);
 	TFT_CS_SetHigh;
 }
 
+/*!
+	@brief Write a sequence of commands and parameters to device
+	@param pSeq array of bytes, entries OR'ed with TFT_SEQ_DATA are data, others commands
+	@param len number of entries
+	@note With PIO SPI the whole sequence goes into the FIFO with DC in each
+		  word, so there are no CPU GPIO writes. Other SPI types group
+		  consecutive parameters into one buffer write.
+*/
+void ST7789_TFT_graphics::writeCommandSequence(const uint16_t *pSeq, uint8_t len)
+{
+	uint8_t i = 0;
+	if (_pioSPI == true)
+	{
+		pixel12Flush();
+		TFTDMAWait();
+		pioSetMode(TFT_PIO_MODE_CMD);
+		for (i = 0; i < len; i++)
+			pio_sm_put_blocking(_pPIO, _pioSM, ((uint32_t)(pSeq[i] & TFT_SEQ_DATA) << 23) | ((uint32_t)(pSeq[i] & 0xFF) << 23));
+		return;
+	}
+	while (i < len)
+	{
+		if ((pSeq[i] & TFT_SEQ_DATA) == 0)
+		{
+			writeCommand(pSeq[i++]);
+			continue;
+		}
+		uint8_t params[8];
+		uint8_t count = 0;
+		while (i < len && (pSeq[i] & TFT_SEQ_DATA) && count < sizeof(params))
+			params[count++] = pSeq[i++] & 0xFF;
+		spiWriteDataBuffer(params, count);
+	}
+}
+
 /*!
 	@brief  Write byte to SPI
 	@param spiData byte to write
@@ -1326,12 +2638,21 @@ void ST7789_TFT_graphics::spiWriteSoftware(uint8_t spiData)
 }
 
 /*!
-	@brief  Write a buffer to SPI, both Software and hardware SPI supported
+	@brief  Write a buffer to SPI, Software, Hardware and PIO SPI supported
 	@param spiData to send
 	@param len length of buffer
 */
 void ST7789_TFT_graphics::spiWriteDataBuffer(uint8_t *spiData, uint32_t len)
 {
+	TFTDMAWait();
+	if (_pioSPI == true)
+	{
+		pioSetMode(TFT_PIO_MODE_PIXEL8);
+		for (uint32_t i = 0; i < len; i++)
+			pio_sm_put_blocking(_pPIO, _pioSM, (uint32_t)spiData[i] << 24);
+		return;
+	}
+	spiSetFrameSize(8);
 	TFT_DC_SetHigh;
 	TFT_CS_SetLow;
 	if (_hardwareSPI == false)
@@ -1348,6 +2669,918 @@ void ST7789_TFT_graphics::spiWriteDataBuffer(uint8_t *spiData, uint32_t len)
 	TFT_CS_SetHigh;
 }
 
+/*!
+	@brief  Start writing a buffer to SPI, returns while the data is still being clocked out
+	@param spiData to send, must stay valid until the transfer completes
+	@param len length of buffer
+	@note Uses DMA if Hardware or PIO SPI and a DMA channel was claimed at init,
+		  otherwise falls back to the blocking spiWriteDataBuffer.
+		  CS is held low until TFTDMAWait is called, every other SPI
+		  method calls TFTDMAWait before touching the bus.
+*/
+void ST7789_TFT_graphics::spiWriteDataBufferBegin(uint8_t *spiData, uint32_t len)
+{
+	if (_dmaChannel < 0)
+	{
+		spiWriteDataBuffer(spiData, len);
+		return;
+	}
+	TFTDMAWait();
+	if (_pioSPI == true)
+	{
+		pioSetMode(TFT_PIO_MODE_PIXEL8);
+	}
+	else
+	{
+		spiSetFrameSize(8);
+		TFT_DC_SetHigh;
+		TFT_CS_SetLow;
+	}
+	dmaStart(spiData, len, DMA_SIZE_8, true);
+}
+
+/*!
+	@brief Start a DMA transfer into the Hardware SPI or PIO transmit FIFO
+	@param pSrc read address
+	@param count number of transfers
+	@param size DMA_SIZE_8 or DMA_SIZE_16, must match the current frame size
+	@param incrementRead false to resend the word at one fixed address
+	@note DC and CS must already be set, TFTDMAWait completes the transfer.
+*/
+void ST7789_TFT_graphics::dmaStart(const volatile void *pSrc, uint32_t count, dma_channel_transfer_size size, bool incrementRead)
+{
+	dma_channel_config dmaConfig = dma_channel_get_default_config(_dmaChannel);
+	channel_config_set_transfer_data_size(&dmaConfig, size);
+	channel_config_set_read_increment(&dmaConfig, incrementRead);
+	volatile void *pDst = dmaTarget(&dmaConfig);
+	dma_channel_configure(_dmaChannel, &dmaConfig, pDst, pSrc, count, true);
+	_dmaActive = true;
+}
+
+/*!
+	@brief Start a chained DMA transfer of the rows in _dmaRowTable
+	@param count number of transfers per row
+	@param rows number of rows in the table, followed by a nullptr entry
+	@param size DMA_SIZE_8 or DMA_SIZE_16, must match the current frame size
+	@note The control channel writes each row start into the read address
+		trigger of the data channel, which chains back to the control channel
+		when the row is done. The nullptr entry is a null trigger and ends the
+		chain. DC and CS must already be set, TFTDMAWait completes the transfer.
+*/
+void ST7789_TFT_graphics::dmaStartRows(uint32_t count, uint16_t rows, dma_channel_transfer_size size)
+{
+	dma_channel_config dataConfig = dma_channel_get_default_config(_dmaChannel);
+	channel_config_set_transfer_data_size(&dataConfig, size);
+	channel_config_set_chain_to(&dataConfig, _dmaCtrlChannel);
+	channel_config_set_irq_quiet(&dataConfig, true);
+	volatile void *pDst = dmaTarget(&dataConfig);
+	dma_channel_configure(_dmaChannel, &dataConfig, pDst, nullptr, count, false);
+
+	dma_channel_config ctrlConfig = dma_channel_get_default_config(_dmaCtrlChannel);
+	channel_config_set_transfer_data_size(&ctrlConfig, DMA_SIZE_32);
+	channel_config_set_read_increment(&ctrlConfig, true);
+	channel_config_set_write_increment(&ctrlConfig, false);
+	_dmaChainEnd = (uintptr_t)&_dmaRowTable[rows + 1];
+	_dmaActive = true;
+	dma_channel_configure(_dmaCtrlChannel, &ctrlConfig, &dma_hw->ch[_dmaChannel].al3_read_addr_trig, _dmaRowTable, 1, true);
+}
+
+/*!
+	@brief Set the pacing of a DMA channel for the Hardware SPI or PIO transmit FIFO
+	@param pConfig channel config, its DREQ is set
+	@return the transmit FIFO address to write to
+*/
+volatile void *ST7789_TFT_graphics::dmaTarget(dma_channel_config *pConfig)
+{
+	if (_pioSPI == true)
+	{
+		channel_config_set_dreq(pConfig, pio_get_dreq(_pPIO, _pioSM, true));
+		return &_pPIO->txf[_pioSM];
+	}
+	channel_config_set_dreq(pConfig, spi_get_dreq(_pspiInterface, true));
+	return &spi_get_hw(_pspiInterface)->dr;
+}
+
+/*!
+	@brief Stream rows that are not next to each other in memory into the current address window
+	@param pFirst first pixel of the top row
+	@param w row width in pixels
+	@param h number of rows
+	@param stride distance from one row to the next in bytes
+	@param bytes true for big-endian pixel bytes as pushPixelBytes, false for native colors as pushPixels16
+	@note With a second DMA channel the rows go out as chained transfers of up
+		to TFT_DMA_CHAIN_ROWS rows, with no CPU work between rows. The last
+		rows may still be sending on return, call TFTDMAWait before modifying
+		the data. Otherwise each row is pushed on its own.
+*/
+void ST7789_TFT_graphics::pushPixelRows(const void *pFirst, uint16_t w, uint16_t h, uint32_t stride, bool bytes)
+{
+	const uint8_t *pRow = static_cast<const uint8_t *>(pFirst);
+	if (_dmaCtrlChannel < 0 || w < 16 || h < 2 || frameBufferOn() || _clipStream == true || _pixel12 == true)
+	{
+		for (uint16_t j = 0; j < h; j++, pRow += stride)
+		{
+			if (bytes == true)
+				pushPixelBytes(const_cast<uint8_t *>(pRow), (uint32_t)w * 2);
+			else
+				pushPixels16(reinterpret_cast<const uint16_t *>(pRow), w);
+		}
+		return;
+	}
+	while (h > 0)
+	{
+		uint16_t rows = (h > TFT_DMA_CHAIN_ROWS) ? TFT_DMA_CHAIN_ROWS : h;
+		TFTDMAWait(); // row table is reused
+		for (uint16_t j = 0; j < rows; j++, pRow += stride)
+			_dmaRowTable[j] = pRow;
+		_dmaRowTable[rows] = nullptr;
+		if (_pioSPI == true)
+		{
+			pioSetMode(bytes ? TFT_PIO_MODE_PIXEL8 : TFT_PIO_MODE_PIXEL16);
+		}
+		else
+		{
+			spiSetFrameSize(bytes ? 8 : 16);
+			TFT_DC_SetHigh;
+			TFT_CS_SetLow;
+		}
+		dmaStartRows(bytes ? (uint32_t)w * 2 : w, rows, bytes ? DMA_SIZE_8 : DMA_SIZE_16);
+		h -= rows;
+	}
+}
+
+/*!
+	@brief Check if a DMA transfer to the TFT is still in progress
+	@return true if DMA or the SPI shifter is still busy
+*/
+bool ST7789_TFT_graphics::TFTDMABusy(void)
+{
+	if (_dmaActive == false)
+		return false;
+	if (_dmaChainEnd != 0 && dma_channel_hw_addr(_dmaCtrlChannel)->read_addr != _dmaChainEnd)
+		return true;
+	if (_pioSPI == true)
+		return dma_channel_is_busy(_dmaChannel) || !pio_sm_is_tx_fifo_empty(_pPIO, _pioSM);
+	return dma_channel_is_busy(_dmaChannel) || spi_is_busy(_pspiInterface);
+}
+
+/*!
+	@brief Wait for a DMA transfer to the TFT to complete and release CS
+	@note Safe to call when no transfer is in progress.
+		  Call before modifying a buffer passed to a DMA draw method.
+*/
+void ST7789_TFT_graphics::TFTDMAWait(void)
+{
+	if (_dmaActive == false)
+		return;
+	if (_dmaChainEnd != 0)
+	{
+		// Between rows neither channel is busy, the chain is done once the nullptr entry is read
+		while (dma_channel_hw_addr(_dmaCtrlChannel)->read_addr != _dmaChainEnd)
+			tight_loop_contents();
+		dma_channel_wait_for_finish_blocking(_dmaCtrlChannel);
+		_dmaChainEnd = 0;
+	}
+	dma_channel_wait_for_finish_blocking(_dmaChannel);
+	_dmaActive = false;
+	if (_pioSPI == true)
+		return; // PIO keeps CS low, the next mode switch waits for the shifter
+	// DMA is done when last byte enters the FIFO, wait for the shifter
+	while (spi_is_busy(_pspiInterface))
+		tight_loop_contents();
+	// Drain RX FIFO and clear the overrun flag, nothing is read from the TFT
+	while (spi_is_readable(_pspiInterface))
+		(void)spi_get_hw(_pspiInterface)->dr;
+	spi_get_hw(_pspiInterface)->icr = SPI_SSPICR_RORIC_BITS;
+	TFT_CS_SetHigh;
+}
+
+/*!
+	@brief Turn frame buffer mode on or off
+	@param pBuffer RGB565 frame buffer of at least screen width * height pixels, nullptr to turn off
+	@param bufferSize size of pBuffer in pixels
+	@return
+		-# Display_Success=success
+		-# Display_BufferSize=buffer smaller than the screen
+	@note In frame buffer mode all drawing goes to RAM and the changed areas
+		are sent to the display by TFTflush. The buffer is laid out for the
+		current rotation, set the rotation first. Turning off does not flush.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTsetFrameBuffer(uint16_t *pBuffer, uint32_t bufferSize)
+{
+	TFTDMAWait();
+	if (pBuffer == nullptr)
+	{
+		_pFrameBuffer = nullptr;
+		_pIndexBuffer = nullptr;
+		_bandMode = false;
+		std::fill(_dirtyTiles, _dirtyTiles + TFT_TILE_ROWS_MAX, 0);
+		return Display_Success;
+	}
+	if (bufferSize < (uint32_t)_widthTFT * _heightTFT)
+	{
+		printf("Error TFTsetFrameBuffer 1: Buffer size %lu is less than screen %u x %u\r\n", (unsigned long)bufferSize, _widthTFT, _heightTFT);
+		return Display_BufferSize;
+	}
+	_pFrameBuffer = pBuffer;
+	_pIndexBuffer = nullptr;
+	_fbWidth = _widthTFT;
+	_fbHeight = _heightTFT;
+	_fbRowOffset = 0;
+	_bandMode = false;
+	_fbWinValid = false;
+	std::fill(_dirtyTiles, _dirtyTiles + TFT_TILE_ROWS_MAX, 0);
+	return Display_Success;
+}
+
+/*!
+	@brief Send the changed areas of the frame buffer to the display
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=frame buffer mode is off
+	@note Dirty tiles are merged into rectangles, runs of tiles along a row
+		grown down over the rows below with the same run, one window each.
+		Uses DMA if enabled, a rectangle the full width of the buffer goes
+		as one burst, a narrower one as chained rows. Returns once the data
+		is sent so the buffer can be drawn into again straight away.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTflush(void)
+{
+	if (!frameBufferOn())
+	{
+		printf("Error TFTflush 1: Frame buffer mode is off\r\n");
+		return Display_BufferNullptr;
+	}
+	if (_bandMode == true)
+	{
+		printf("Error TFTflush 2: Band mode is on, use TFTbandNext\r\n");
+		return Display_GenericError;
+	}
+	uint16_t *pBuffer = _pFrameBuffer;
+	uint8_t *pIndex = _pIndexBuffer;
+	_pFrameBuffer = nullptr; // stream to the bus while flushing
+	_pIndexBuffer = nullptr;
+	uint8_t tileRows = (_fbHeight + TFT_TILE_SIZE - 1) >> TFT_TILE_SHIFT;
+	for (uint8_t row = 0; row < tileRows; row++)
+	{
+		while (_dirtyTiles[row] != 0)
+		{
+			// Run of dirty tiles along this row
+			uint8_t col0 = __builtin_ctz(_dirtyTiles[row]);
+			uint8_t col1 = col0;
+			while (col1 + 1 < 32 && (_dirtyTiles[row] & (1u << (col1 + 1))))
+				col1++;
+			uint32_t runMask = ((col1 == 31) ? 0xFFFFFFFF : ((1u << (col1 + 1)) - 1)) & ~((1u << col0) - 1);
+			// Grow down over rows where the same tiles are dirty
+			uint8_t rowEnd = row;
+			while (rowEnd + 1 < tileRows && (_dirtyTiles[rowEnd + 1] & runMask) == runMask)
+				rowEnd++;
+			for (uint8_t r = row; r <= rowEnd; r++)
+				_dirtyTiles[r] &= ~runMask;
+			uint16_t x1 = ((col1 + 1) << TFT_TILE_SHIFT) - 1;
+			uint16_t y1 = ((rowEnd + 1) << TFT_TILE_SHIFT) - 1;
+			flushRect(pBuffer, pIndex, col0 << TFT_TILE_SHIFT, row << TFT_TILE_SHIFT,
+					  (x1 >= _fbWidth) ? _fbWidth - 1 : x1, (y1 >= _fbHeight) ? _fbHeight - 1 : y1);
+		}
+	}
+	TFTDMAWait();
+	_pFrameBuffer = pBuffer;
+	_pIndexBuffer = pIndex;
+	return Display_Success;
+}
+
+/*!
+	@brief Start drawing a frame band by band through a strip buffer
+	@param pBuffer RGB565 strip buffer, at least one screen row
+	@param bufferSize size of pBuffer in pixels
+	@param bgColor 565 16-bit color each band is cleared to before drawing
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=buffer smaller than one screen row
+	@note Draw the whole frame once per band, all drawing methods draw into
+		the band and anything outside it is dropped:
+		TFTbandBegin(buf, size, bg); do { draw frame } while (TFTbandNext());
+		With DMA and room for two or more rows the buffer is split in two,
+		one half is drawn while the other is sent.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTbandBegin(uint16_t *pBuffer, uint32_t bufferSize, uint16_t bgColor)
+{
+	TFTDMAWait();
+	if (pBuffer == nullptr)
+	{
+		printf("Error TFTbandBegin 1: Buffer is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	uint32_t rows = bufferSize / _widthTFT;
+	if (rows == 0)
+	{
+		printf("Error TFTbandBegin 2: Buffer size %lu is less than one row of %u\r\n", (unsigned long)bufferSize, _widthTFT);
+		return Display_BufferSize;
+	}
+	_pBandBuffer[0] = pBuffer;
+	_pBandBuffer[1] = pBuffer;
+	if (_dmaChannel >= 0 && rows >= 2)
+	{
+		rows /= 2;
+		_pBandBuffer[1] = pBuffer + rows * _widthTFT;
+	}
+	_bandRows = (rows > _heightTFT) ? _heightTFT : rows;
+	_bandIndex = 0;
+	_bandColor = bgColor;
+	_bandMode = true;
+	_pIndexBuffer = nullptr;
+	_fbWidth = _widthTFT;
+	_fbHeight = _bandRows;
+	_fbRowOffset = 0;
+	_fbWinValid = false;
+	_pFrameBuffer = _pBandBuffer[0];
+	std::fill(_pFrameBuffer, _pFrameBuffer + (uint32_t)_fbWidth * _fbHeight, _bandColor);
+	return Display_Success;
+}
+
+/*!
+	@brief Send the current band and move to the next one
+	@return true if there is another band to draw, false once the frame is complete
+	@note Ends band mode after the last band, drawing then goes to the bus again.
+*/
+bool ST7789_TFT_graphics::TFTbandNext(void)
+{
+	if (_bandMode == false)
+		return false;
+	uint16_t *pBand = _pFrameBuffer;
+	_pFrameBuffer = nullptr; // stream to the bus while sending
+	TFTsetAddrWindow(0, _fbRowOffset, _fbWidth - 1, _fbRowOffset + _fbHeight - 1);
+	pushPixels16(pBand, (uint32_t)_fbWidth * _fbHeight);
+	uint16_t nextRow = _fbRowOffset + _fbHeight;
+	if (nextRow >= _heightTFT)
+	{
+		TFTDMAWait();
+		_bandMode = false;
+		return false;
+	}
+	_bandIndex ^= 1;
+	if (_pBandBuffer[0] == _pBandBuffer[1])
+		TFTDMAWait(); // one buffer, wait before drawing into it again
+	_fbRowOffset = nextRow;
+	_fbHeight = (_heightTFT - nextRow < _bandRows) ? _heightTFT - nextRow : _bandRows;
+	_fbWinValid = false;
+	_pFrameBuffer = _pBandBuffer[_bandIndex];
+	std::fill(_pFrameBuffer, _pFrameBuffer + (uint32_t)_fbWidth * _fbHeight, _bandColor);
+	return true;
+}
+
+/*!
+	@brief Mark an area of the frame buffer to be sent on the next flush
+	@param x left column
+	@param y top row
+	@param w width of the area
+	@param h height of the area
+	@note Drawing methods mark their own areas, use this after writing into
+		the frame buffer array directly.
+*/
+void ST7789_TFT_graphics::TFTmarkDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+	if (!frameBufferOn() || _bandMode || w == 0 || h == 0 || x >= _fbWidth || y >= _fbHeight)
+		return;
+	uint16_t x1 = (x + w - 1 >= _fbWidth) ? _fbWidth - 1 : x + w - 1;
+	uint16_t y1 = (y + h - 1 >= _fbHeight) ? _fbHeight - 1 : y + h - 1;
+	markDirtyRect(x, y, x1, y1);
+}
+
+/*!
+	@brief Mark the tiles covering an area dirty
+	@param x0 left column
+	@param y0 top row
+	@param x1 right column
+	@param y1 bottom row
+*/
+void ST7789_TFT_graphics::markDirtyRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint8_t col0 = x0 >> TFT_TILE_SHIFT, col1 = x1 >> TFT_TILE_SHIFT;
+	uint8_t row1 = y1 >> TFT_TILE_SHIFT;
+	if (row1 >= TFT_TILE_ROWS_MAX)
+		row1 = TFT_TILE_ROWS_MAX - 1;
+	uint32_t mask = ((col1 >= 31) ? 0xFFFFFFFF : ((1u << (col1 + 1)) - 1)) & ~((1u << col0) - 1);
+	for (uint8_t row = y0 >> TFT_TILE_SHIFT; row <= row1; row++)
+		_dirtyTiles[row] |= mask;
+}
+
+/*!
+	@brief Send one rectangle of a frame buffer to the display
+	@param pBuffer RGB565 frame buffer, nullptr if indexed
+	@param pIndex indexed frame buffer, nullptr if RGB565
+	@param x0 left column
+	@param y0 top row
+	@param x1 right column
+	@param y1 bottom row
+	@note Used internally by TFTflush, frame buffer mode must be paused.
+		Indexed rows are expanded through the palette into a pair of row
+		buffers, with DMA one row is expanded while the other is sent.
+		A row wider than TFT_ROW_PIXELS_MAX is expanded in slices.
+*/
+void ST7789_TFT_graphics::flushRect(const uint16_t *pBuffer, const uint8_t *pIndex, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint16_t w = x1 - x0 + 1;
+	uint16_t h = y1 - y0 + 1;
+	TFTsetAddrWindow(x0, y0, x1, y1);
+	if (pIndex != nullptr)
+	{
+		uint16_t rowBuffer[2][TFT_ROW_PIXELS_MAX];
+		uint8_t half = 0;
+		for (uint16_t j = 0; j < h; j++)
+		{
+			for (uint16_t slice = 0; slice < w; slice += TFT_ROW_PIXELS_MAX)
+			{
+				uint16_t *pRow = rowBuffer[half];
+				uint16_t count = std::min<uint16_t>(w - slice, TFT_ROW_PIXELS_MAX);
+				half ^= 1;
+				indexExpandRow(pIndex + (uint32_t)(y0 + j) * _fbStride, x0 + slice, count, pRow);
+				pushPixels16(pRow, count);
+			}
+		}
+		TFTDMAWait(); // row buffers are on the stack
+		return;
+	}
+	const uint16_t *pRow = pBuffer + (uint32_t)y0 * _fbWidth + x0;
+	if (w == _fbWidth)
+	{
+		pushPixels16(pRow, (uint32_t)w * h);
+		return;
+	}
+	pushPixelRows(pRow, w, h, (uint32_t)_fbWidth * sizeof(uint16_t), false);
+}
+
+/*!
+	@brief Set the frame buffer window that following pixel writes fill
+	@param x0 left column
+	@param y0 top row
+	@param x1 right column
+	@param y1 bottom row
+	@note Frame buffer counterpart of TFTsetAddrWindow, the window is marked dirty.
+		In band mode a window that misses the current band is dropped.
+*/
+void ST7789_TFT_graphics::frameBufferSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	uint16_t lastRow = _fbRowOffset + _fbHeight - 1; // last screen row held in the buffer
+	_fbWinValid = (x0 <= x1) && (y0 <= y1) && (x1 < _fbWidth) && (y0 <= lastRow) && (y1 >= _fbRowOffset);
+	if (!_fbWinValid)
+		return;
+	_fbWinX0 = _fbCursorX = x0;
+	_fbWinY0 = _fbCursorY = y0;
+	_fbWinX1 = x1;
+	_fbWinY1 = y1;
+	if (_bandMode == false)
+		markDirtyRect(x0, y0, x1, y1);
+}
+
+/*!
+	@brief Write pixels into the frame buffer window, row by row like the display RAM
+	@param pPixels 565 16-bit colors, nullptr to write color count times
+	@param color 565 16-bit color, used if pPixels is nullptr
+	@param count number of pixels
+*/
+void ST7789_TFT_graphics::frameBufferWrite(const uint16_t *pPixels, uint16_t color, uint32_t count)
+{
+	if (!_fbWinValid)
+		return;
+	while (count > 0)
+	{
+		uint32_t n = _fbWinX1 - _fbCursorX + 1; // pixels left on this row of the window
+		if (n > count)
+			n = count;
+		if (_pIndexBuffer != nullptr)
+		{
+			uint8_t *pRow = _pIndexBuffer + (uint32_t)_fbCursorY * _fbStride;
+			for (uint32_t k = 0; k < n; k++)
+				indexWrite(pRow, _fbCursorX + k, paletteIndex(pPixels == nullptr ? color : pPixels[k]));
+		}
+		// Rows outside the buffer (band mode) are stepped over
+		else if (_fbCursorY >= _fbRowOffset && (_fbCursorY - _fbRowOffset) < _fbHeight)
+		{
+			uint16_t *pDst = _pFrameBuffer + (uint32_t)(_fbCursorY - _fbRowOffset) * _fbWidth + _fbCursorX;
+			if (pPixels == nullptr)
+				std::fill(pDst, pDst + n, color);
+			else
+				std::copy(pPixels, pPixels + n, pDst);
+		}
+		if (pPixels != nullptr)
+			pPixels += n;
+		count -= n;
+		_fbCursorX += n;
+		if (_fbCursorX > _fbWinX1)
+		{
+			_fbCursorX = _fbWinX0;
+			_fbCursorY = (_fbCursorY == _fbWinY1) ? _fbWinY0 : _fbCursorY + 1;
+		}
+	}
+}
+
+/*!
+	@brief Turn indexed color frame buffer mode on
+	@param pBuffer frame buffer of at least (width * bitsPerPixel + 7) / 8 * height bytes
+	@param bufferSize size of pBuffer in bytes
+	@param bitsPerPixel 8, 4 or 1
+	@param pPalette 565 16-bit colors, nullptr for the default palette, must
+		stay valid while the buffer is in use, it is not copied
+	@param paletteSize number of colors in pPalette, up to 1 << bitsPerPixel
+	@return
+		-# Display_Success=success
+		-# Display_BufferNullptr=invalid pointer object
+		-# Display_BufferSize=buffer smaller than the screen
+		-# Display_GenericError=bits per pixel not 8, 4 or 1
+	@note Works like TFTsetFrameBuffer but stores a palette index per pixel,
+		drawing colors are mapped to the nearest palette entry. The default
+		palette holds the ST7789_ color defines, black and white first.
+		TFTsetFrameBuffer(nullptr, 0) turns it off.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTsetFrameBufferIndexed(uint8_t *pBuffer, uint32_t bufferSize, uint8_t bitsPerPixel, const uint16_t *pPalette, uint16_t paletteSize)
+{
+	TFTDMAWait();
+	if (pBuffer == nullptr)
+	{
+		printf("Error TFTsetFrameBufferIndexed 1: Buffer is nullptr\r\n");
+		return Display_BufferNullptr;
+	}
+	if (bitsPerPixel != 8 && bitsPerPixel != 4 && bitsPerPixel != 1)
+	{
+		printf("Error TFTsetFrameBufferIndexed 2: Bits per pixel %u must be 8, 4 or 1\r\n", bitsPerPixel);
+		return Display_GenericError;
+	}
+	uint16_t stride = ((uint32_t)_widthTFT * bitsPerPixel + 7) / 8;
+	if (bufferSize < (uint32_t)stride * _heightTFT)
+	{
+		printf("Error TFTsetFrameBufferIndexed 3: Buffer size %lu is less than %lu\r\n", (unsigned long)bufferSize, (unsigned long)stride * _heightTFT);
+		return Display_BufferSize;
+	}
+	_pIndexBuffer = pBuffer;
+	_pFrameBuffer = nullptr;
+	_fbBpp = bitsPerPixel;
+	_fbStride = stride;
+	_fbWidth = _widthTFT;
+	_fbHeight = _heightTFT;
+	_fbRowOffset = 0;
+	_bandMode = false;
+	_fbWinValid = false;
+	std::fill(_dirtyTiles, _dirtyTiles + TFT_TILE_ROWS_MAX, 0);
+	if (pPalette == nullptr)
+		TFTsetPalette(defaultPalette, sizeof(defaultPalette) / sizeof(defaultPalette[0]));
+	else
+		TFTsetPalette(pPalette, paletteSize);
+	return Display_Success;
+}
+
+/*!
+	@brief Load the palette used by the indexed color frame buffer
+	@param pPalette 565 16-bit colors, must stay valid while the buffer is in use
+	@param paletteSize number of colors, entries past 1 << bits per pixel are ignored
+	@note The whole screen is marked dirty, so the next TFTflush recolors it
+		without drawing it again. Pixels with an index past the end of a
+		smaller palette are shown in its first color.
+*/
+void ST7789_TFT_graphics::TFTsetPalette(const uint16_t *pPalette, uint16_t paletteSize)
+{
+	if (pPalette == nullptr || paletteSize == 0)
+		return;
+	uint16_t maxSize = 1u << _fbBpp;
+	_paletteSize = (paletteSize > maxSize) ? maxSize : paletteSize;
+	_pPalette = pPalette;
+	_paletteCacheValid = false;
+	if (_pIndexBuffer != nullptr)
+		markDirtyRect(0, 0, _fbWidth - 1, _fbHeight - 1);
+}
+
+/*!
+	@brief Find the palette index for a color
+	@param color 565 16-bit
+	@return index of the exact or, if none, the nearest palette color
+	@note The last color looked up is cached, drawing calls mostly repeat one color.
+*/
+uint8_t ST7789_TFT_graphics::paletteIndex(uint16_t color)
+{
+	if (_paletteCacheValid && color == _paletteCacheColor)
+		return _paletteCacheIndex;
+	uint8_t best = 0;
+	uint32_t bestDistance = UINT32_MAX;
+	for (uint16_t i = 0; i < _paletteSize && bestDistance != 0; i++)
+	{
+		// Distance in 6 bit per channel space, red and blue doubled up from 5 bits
+		int32_t dr = ((color >> 11) - (_pPalette[i] >> 11)) * 2;
+		int32_t dg = ((color >> 5) & 0x3F) - ((_pPalette[i] >> 5) & 0x3F);
+		int32_t db = ((color & 0x1F) - (_pPalette[i] & 0x1F)) * 2;
+		uint32_t distance = dr * dr + dg * dg + db * db;
+		if (distance < bestDistance)
+		{
+			bestDistance = distance;
+			best = i;
+		}
+	}
+	_paletteCacheColor = color;
+	_paletteCacheIndex = best;
+	_paletteCacheValid = true;
+	return best;
+}
+
+/*!
+	@brief Store a palette index in a row of the indexed frame buffer
+	@param pRow start of the row
+	@param x column
+	@param index palette index
+	@note 4 bpp stores the left pixel in the high nibble, 1 bpp the left pixel in bit 7
+*/
+void ST7789_TFT_graphics::indexWrite(uint8_t *pRow, uint16_t x, uint8_t index)
+{
+	switch (_fbBpp)
+	{
+	case 8:
+		pRow[x] = index;
+		break;
+	case 4:
+		if (x & 1)
+			pRow[x >> 1] = (pRow[x >> 1] & 0xF0) | (index & 0x0F);
+		else
+			pRow[x >> 1] = (pRow[x >> 1] & 0x0F) | (index << 4);
+		break;
+	default:
+		if (index & 1)
+			pRow[x >> 3] |= (0x80 >> (x & 7));
+		else
+			pRow[x >> 3] &= ~(0x80 >> (x & 7));
+		break;
+	}
+}
+
+/*!
+	@brief Expand part of an indexed frame buffer row to 565 colors through the palette
+	@param pRow start of the row
+	@param x first column
+	@param w number of pixels
+	@param pOut 565 16-bit output, w entries
+*/
+void ST7789_TFT_graphics::indexExpandRow(const uint8_t *pRow, uint16_t x, uint16_t w, uint16_t *pOut)
+{
+	for (uint16_t i = 0; i < w; i++, x++)
+	{
+		uint8_t index;
+		switch (_fbBpp)
+		{
+		case 8:
+			index = pRow[x];
+			break;
+		case 4:
+			index = (x & 1) ? (pRow[x >> 1] & 0x0F) : (pRow[x >> 1] >> 4);
+			break;
+		default:
+			index = (pRow[x >> 3] >> (7 - (x & 7))) & 1;
+			break;
+		}
+		pOut[i] = _pPalette[(index < _paletteSize) ? index : 0];
+	}
+}
+
+/*!
+	@brief Stream big-endian 565 pixel bytes into the current address window
+	@param pData pixel data, high byte first, must stay valid until the transfer completes
+	@param count number of bytes, two per pixel
+	@note Uses DMA if enabled, call TFTDMAWait before reusing the data.
+*/
+void ST7789_TFT_graphics::pushPixelBytes(uint8_t *pData, uint32_t count)
+{
+	if (!frameBufferOn() && _clipStream == true)
+	{
+		uint32_t pixels = count / 2;
+		pData += clipStream(pixels) * 2;
+		count = pixels * 2;
+	}
+	if (!frameBufferOn() && _pixel12 == false)
+	{
+		if (count > 0)
+			spiWriteDataBufferBegin(pData, count);
+		return;
+	}
+	// Join the bytes into colors a few at a time for the frame buffer or 12-bit packing
+	uint16_t colors[16];
+	uint32_t i = 0;
+	while (i + 1 < count)
+	{
+		uint8_t n = 0;
+		for (; n < 16 && i + 1 < count; n++, i += 2)
+			colors[n] = (pData[i] << 8) | pData[i + 1];
+		if (frameBufferOn())
+			frameBufferWrite(colors, 0, n);
+		else
+			pushPixels12(colors, 0, n);
+	}
+}
+
+/*!
+	@brief Apply the partial area clip to the pixels of a stream write
+	@param count pixels to be written, reduced to the pixels inside the area
+	@return number of leading pixels to skip before the ones to send
+	@note The window was already trimmed to the area by TFTsetAddrWindow,
+		this drops the pixels of the rows above and below it.
+*/
+uint32_t ST7789_TFT_graphics::clipStream(uint32_t &count)
+{
+	uint32_t skip = (_clipSkip < count) ? _clipSkip : count;
+	_clipSkip -= skip;
+	count -= skip;
+	if (count > _clipSend)
+		count = _clipSend;
+	_clipSend -= count;
+	return skip;
+}
+
+/*!
+	@brief Convert a 565 16-bit color to 444 12-bit
+	@param color 565 16-bit color
+	@return 444 12-bit color, red in bits 11-8
+*/
+uint16_t ST7789_TFT_graphics::TFTcolor565to444(uint16_t color)
+{
+	return ((color >> 4) & 0x0F00) | ((color >> 3) & 0x00F0) | ((color >> 1) & 0x000F);
+}
+
+/*!
+	@brief Convert 565 16-bit colors to packed 12-bit pixel data for TFTdrawBitmap12Data
+	@param pSrc 565 16-bit colors
+	@param pDst packed output, (pixels * 3 + 1) / 2 bytes, two pixels in three bytes
+	@param pixels number of pixels
+	@return
+		-# Display_Success=success
+		-# Display_BitmapNullptr=invalid pointer object
+	@note Converting stored images once saves the conversion on every draw,
+		and the packed data is 25% smaller.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTconvert565to444(const uint16_t *pSrc, uint8_t *pDst, uint32_t pixels)
+{
+	if (pSrc == nullptr || pDst == nullptr)
+	{
+		printf("Error TFTconvert565to444 1: Array is nullptr\r\n");
+		return Display_BitmapNullptr;
+	}
+	for (uint32_t i = 0; i + 1 < pixels; i += 2)
+	{
+		uint16_t first = TFTcolor565to444(pSrc[i]);
+		uint16_t second = TFTcolor565to444(pSrc[i + 1]);
+		*pDst++ = first >> 4;
+		*pDst++ = ((first & 0x0F) << 4) | (second >> 8);
+		*pDst++ = second & 0xFF;
+	}
+	if (pixels & 1)
+	{
+		uint16_t last = TFTcolor565to444(pSrc[pixels - 1]);
+		*pDst++ = last >> 4;
+		*pDst = (last & 0x0F) << 4;
+	}
+	return Display_Success;
+}
+
+/*!
+	@brief Pack and send pixels in the 12-bit pixel format
+	@param pPixels 565 16-bit colors, nullptr to send color count times
+	@param color 565 16-bit color, used if pPixels is nullptr
+	@param count number of pixels
+	@note Two pixels go in three bytes, an odd pixel is held back for the next
+		call and sent, padded to a whole byte, at the end of the address window
+		or before the next command. Long fills resend one packed chunk.
+		The packed buffers are on the stack, so DMA is waited for on return.
+*/
+void ST7789_TFT_graphics::pushPixels12(const uint16_t *pPixels, uint16_t color, uint32_t count)
+{
+	uint8_t buffers[2][TFT_PIXEL12_CHUNK / 2 * 3 + 2]; // one packed while the other is sent
+	uint8_t index = 0;
+	uint16_t color444 = TFTcolor565to444(color);
+	if (pPixels == nullptr && _pixel12Pending == false && count >= TFT_PIXEL12_CHUNK)
+	{
+		// Whole pairs of one color are the same three bytes, pack a chunk once
+		uint8_t *pChunk = buffers[index];
+		index ^= 1;
+		for (uint16_t i = 0; i < TFT_PIXEL12_CHUNK / 2 * 3; i += 3)
+		{
+			pChunk[i] = color444 >> 4;
+			pChunk[i + 1] = ((color444 & 0x0F) << 4) | (color444 >> 8);
+			pChunk[i + 2] = color444 & 0xFF;
+		}
+		while (count >= TFT_PIXEL12_CHUNK)
+		{
+			spiWriteDataBufferBegin(pChunk, TFT_PIXEL12_CHUNK / 2 * 3);
+			count -= TFT_PIXEL12_CHUNK;
+			_pixel12Left = (_pixel12Left > TFT_PIXEL12_CHUNK) ? _pixel12Left - TFT_PIXEL12_CHUNK : 0;
+		}
+	}
+	while (count > 0)
+	{
+		uint8_t *pOut = buffers[index];
+		uint16_t len = 0;
+		while (count > 0 && len + 5u <= sizeof(buffers[0]))
+		{
+			uint16_t pixel = (pPixels == nullptr) ? color444 : TFTcolor565to444(*pPixels++);
+			count--;
+			bool windowEnd = (_pixel12Left > 0 && --_pixel12Left == 0);
+			if (_pixel12Pending == false)
+			{
+				_pixel12Value = pixel;
+				_pixel12Pending = true;
+			}
+			else
+			{
+				pOut[len++] = _pixel12Value >> 4;
+				pOut[len++] = ((_pixel12Value & 0x0F) << 4) | (pixel >> 8);
+				pOut[len++] = pixel & 0xFF;
+				_pixel12Pending = false;
+			}
+			if (windowEnd && _pixel12Pending)
+			{
+				// Last pixel of the window, the pad bits are dropped by the TFT
+				pOut[len++] = _pixel12Value >> 4;
+				pOut[len++] = (_pixel12Value & 0x0F) << 4;
+				_pixel12Pending = false;
+			}
+		}
+		if (len > 0)
+		{
+			spiWriteDataBufferBegin(pOut, len); // DMA sends one buffer while the other is packed
+			index ^= 1;
+		}
+	}
+	TFTDMAWait();
+}
+
+/*!
+	@brief Send a 12-bit pixel held back by pushPixels12, padded to a whole byte
+	@note Called before every command, so a window with an odd number of
+		pixels written is always completed.
+*/
+void ST7789_TFT_graphics::pixel12Flush(void)
+{
+	if (_pixel12Pending == false)
+		return;
+	_pixel12Pending = false;
+	uint8_t lastPixel[2] = {uint8_t(_pixel12Value >> 4), uint8_t((_pixel12Value & 0x0F) << 4)};
+	spiWriteDataBuffer(lastPixel, sizeof(lastPixel));
+}
+
+/*!
+	@brief Draw a bitmap of packed 12-bit pixel data
+	@param x X coordinate
+	@param y Y coordinate
+	@param pBmp packed data from TFTconvert565to444, (w * h * 3 + 1) / 2 bytes
+	@param w width of the bitmap in pixels
+	@param h height of the bitmap in pixels
+	@return
+		-# Display_Success=success
+		-# Display_BitmapNullptr=invalid pointer object
+		-# Display_BitmapScreenBounds=Co-ordinates out of bounds
+		-# Display_BitmapLargerThanScreen=bitmap does not fit on the screen
+	@note In the 12-bit pixel format the data is sent as is with one window and,
+		if enabled, one DMA burst, call TFTDMAWait before modifying the array.
+		Packed rows are not byte aligned so the bitmap is not clipped.
+*/
+Display_Return_Codes_e ST7789_TFT_graphics::TFTdrawBitmap12Data(uint16_t x, uint16_t y, const uint8_t *pBmp, uint16_t w, uint16_t h)
+{
+	if (pBmp == nullptr)
+	{
+		printf("Error TFTdrawBitmap12Data 1: Bitmap array is nullptr\r\n");
+		return Display_BitmapNullptr;
+	}
+	if ((x >= _widthTFT) || (y >= _heightTFT))
+	{
+		printf("Error TFTdrawBitmap12Data 2: Out of screen bounds\r\n");
+		return Display_BitmapScreenBounds;
+	}
+	if (w == 0 || h == 0 || (x + w) > _widthTFT || (y + h) > _heightTFT)
+	{
+		printf("Error TFTdrawBitmap12Data 3: Bitmap does not fit on screen\r\n");
+		return Display_BitmapLargerThanScreen;
+	}
+	uint32_t pixels = (uint32_t)w * h;
+	TFTsetAddrWindow(x, y, x + w - 1, y + h - 1);
+	if (frameBufferOn() || _pixel12 == false || _clipStream == true)
+	{
+		// Expand back to 565 for the frame buffer or the 16-bit pixel format
+		uint16_t colors[16];
+		uint8_t n = 0;
+		for (uint32_t i = 0; i < pixels; i++)
+		{
+			const uint8_t *pPair = pBmp + (i >> 1) * 3;
+			uint16_t c = (i & 1) ? (((pPair[1] & 0x0F) << 8) | pPair[2]) : ((pPair[0] << 4) | (pPair[1] >> 4));
+			uint8_t r = c >> 8, g = (c >> 4) & 0x0F, b = c & 0x0F;
+			colors[n++] = ((r << 1 | r >> 3) << 11) | ((g << 2 | g >> 2) << 5) | (b << 1 | b >> 3);
+			if (n == 16 || i + 1 == pixels)
+			{
+				pushPixels16(colors, n);
+				TFTDMAWait(); // colors is reused
+				n = 0;
+			}
+		}
+		return Display_Success;
+	}
+	spiWriteDataBufferBegin((uint8_t *)pBmp, (pixels * 3 + 1) / 2);
+	_pixel12Left = 0;
+	return Display_Success;
+}
+
 /*!
 	@brief Set the Cursor Position on screen
 	@param x the x co-ord of the cursor position
@@ -1396,7 +3629,7 @@ void ST7789_TFT_graphics::setTextColor(uint16_t c, uint16_t b)
 	@param w width of the sprite in pixels
 	@param h height of the sprite in pixels
 	@param backgroundColor the background color of sprite (16 bit 565) this will be made transparent
-	@note Experimental , does not use buffer or malloc, just draw pixel
+	@note Opaque pixels are sent in spans of up to TFT_PIXEL_SPAN_MAX, no malloc
 	@return
 		-# Display_Success=success
 		-# Display_BitmapNullptr=invalid pointer object
@@ -1404,7 +3637,7 @@ void ST7789_TFT_graphics::setTextColor(uint16_t c, uint16_t b)
 */
 Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawSpriteData(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h, uint16_t backgroundColor)
 {
-	uint8_t i, j;
+	uint16_t i, j;
 	uint16_t colour;
 	// 1. Check for null pointer
 	if (pBmp == nullptr)
@@ -1418,20 +3651,37 @@ Display_Return_Codes_e  ST7789_TFT_graphics::TFTdrawSpriteData(uint16_t x, uint1
 		printf("Error TFTdrawSprite 2: Sprite out of screen bounds\r\n");
 		return Display_BitmapScreenBounds;
 	}
+	uint16_t bmpWidth = w; // row length of the data array, before clipping
 	if ((x + w - 1) >= _widthTFT)
 		w = _widthTFT - x;
 	if ((y + h - 1) >= _heightTFT)
 		h = _heightTFT - y;
 
+	// Each row sent as spans of opaque pixels, one window per span
+	uint16_t span[TFT_PIXEL_SPAN_MAX];
 	for(j = 0; j < h; j++)
 	{
-		for(i = 0; i < w; i ++)
+		uint8_t *pRow = pBmp + (uint32_t)j * bmpWidth * 2;
+		i = 0;
+		while (i < w)
 		{
-			colour = (pBmp[0] << 8) | pBmp[1];
-			pBmp += 2;
-			if (colour != backgroundColor){
-				TFTdrawPixel(x+i-1, y + j-1, colour);
+			uint16_t n = 0;
+			while (i + n < w && n < TFT_PIXEL_SPAN_MAX)
+			{
+				colour = (pRow[2 * (i + n)] << 8) | pRow[2 * (i + n) + 1];
+				if (colour == backgroundColor)
+					break;
+				span[n++] = colour;
+			}
+			if (n == 0)
+			{
+				i++; // transparent
+				continue;
 			}
+			TFTsetAddrWindow(x + i, y + j, x + i + n - 1, y + j);
+			pushPixels16(span, n);
+			TFTDMAWait(); // span is reused
+			i += n;
 		}
 	}
 	return Display_Success;